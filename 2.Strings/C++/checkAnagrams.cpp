@@ -1,9 +1,16 @@
 /**
  * Anagram Checker
  * 
- * This program checks if two strings are anagrams of each other using two different methods:
+ * This program checks if two strings are anagrams of each other using three different methods:
  * 1. Sorting approach - Sort both strings and compare them
  * 2. Hash map approach - Count character frequencies and verify they match
+ * 3. Histogram approach - Count bytes into fixed 256-entry tables on the stack (no allocation)
+ * 
+ * groupAnagrams sorts a whole batch of words into anagram classes. Each word
+ * gets an order-independent signature (the sum of a random 64-bit key per
+ * character), words are bucketed by signature in an open-addressing table,
+ * and a bucket hit is confirmed with the histogram check, so no sorted copy
+ * of any word is ever made.
  * 
  * Two strings are anagrams if they contain the same characters with the same frequencies,
  * regardless of order. For example, "listen" and "silent" are anagrams.
@@ -11,13 +18,18 @@
  * Time Complexity:
  * - Sorting approach: O(n log n) where n is the length of the strings
  * - Hash map approach: O(n) where n is the total length of both strings
+ * - Histogram approach: O(n), and O(1) when the lengths differ
+ * - groupAnagrams: O(total length of all words)
  * 
  * Space Complexity:
  * - Sorting approach: O(1) if sorting in-place, otherwise O(n)
  * - Hash map approach: O(k) where k is the size of the character set (constant for ASCII)
+ * - Histogram approach: O(1) (4 KB of counters on the stack)
  * 
  * Input: Two strings - "Listen" and "Silent"
- * Output: Whether the strings are anagrams using both methods
+ * Output: Whether the strings are anagrams using all three methods
+ * 
+ * Benchmark: ./checkAnagrams --bench [words]
  */
 
 #include <iostream>  // For input/output operations
@@ -25,6 +37,17 @@
 #include <algorithm> // For transform and sort functions
 #include <cctype>    // For tolower function
 #include <unordered_map> // For hash map implementation
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 /**
  * areAnagrams - Check if two strings are anagrams using sorting approach
@@ -94,7 +117,288 @@ bool areAnagramsUsingMap(const std::string& str1, const std::string& str2) {
     return true;  // All character counts match
 }
 
-int main() {
+// Words up to this length are checked with a single counter table
+constexpr size_t ANAGRAM_SHORT_WORD = 64;
+
+/**
+ * makeFoldTable - Byte -> lowercase byte, for the ASCII letters only (like ::tolower in the C locale)
+ */
+constexpr std::array<unsigned char, 256> makeFoldTable() {
+    std::array<unsigned char, 256> fold{};
+    for (int c = 0; c < 256; c++) fold[c] = (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+    return fold;
+}
+
+constexpr std::array<unsigned char, 256> FOLD_CASE = makeFoldTable();
+
+/**
+ * histogramsCancel - Whether a 256-entry counter table is all zero after case folding
+ */
+bool histogramsCancel(int32_t* counts) {
+    for (int c = 'A'; c <= 'Z'; c++) {
+        counts[c - 'A' + 'a'] += counts[c];
+        counts[c] = 0;
+    }
+#if defined(__AVX2__)
+    __m256i any = _mm256_setzero_si256();
+    for (int c = 0; c < 256; c += 8) {
+        any = _mm256_or_si256(any, _mm256_loadu_si256((const __m256i*)(counts + c)));
+    }
+    return _mm256_testz_si256(any, any);
+#else
+    int32_t any = 0;
+    for (int c = 0; c < 256; c++) any |= counts[c];
+    return any == 0;
+#endif
+}
+
+/**
+ * areAnagramsFast - Check if two strings are anagrams using byte histograms
+ * @str1: First string to compare
+ * @str2: Second string to compare
+ * 
+ * Case-insensitive like the other two methods. Case folding maps one byte to
+ * one byte, so strings of different lengths are rejected immediately.
+ * 
+ * Short words: count str1 up and str2 down in one table; they are anagrams
+ * iff every counter touched by str1 is back to zero (the counters sum to
+ * zero, so any nonzero counter means some counter of a str1 byte is positive).
+ * 
+ * Long words: bytes are counted into four interleaved tables, so consecutive
+ * increments of the same byte do not wait on each other; the tables are then
+ * summed 8 counters at a time (AVX2) and folded.
+ * 
+ * Returns: true if the strings are anagrams, false otherwise
+ */
+bool areAnagramsFast(std::string_view str1, std::string_view str2) {
+    size_t n = str1.size();
+    if (n != str2.size()) return false;
+    const unsigned char* a = reinterpret_cast<const unsigned char*>(str1.data());
+    const unsigned char* b = reinterpret_cast<const unsigned char*>(str2.data());
+    
+    if (n <= ANAGRAM_SHORT_WORD) {
+        int32_t counts[256] = {};
+        for (size_t i = 0; i < n; i++) {
+            counts[FOLD_CASE[a[i]]]++;
+            counts[FOLD_CASE[b[i]]]--;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (counts[FOLD_CASE[a[i]]] != 0) return false;
+        }
+        return true;
+    }
+    
+    alignas(32) int32_t counts[4][256];
+    std::memset(counts, 0, sizeof(counts));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        counts[0][a[i]]++;
+        counts[1][a[i + 1]]++;
+        counts[2][a[i + 2]]++;
+        counts[3][a[i + 3]]++;
+        counts[0][b[i]]--;
+        counts[1][b[i + 1]]--;
+        counts[2][b[i + 2]]--;
+        counts[3][b[i + 3]]--;
+    }
+    for (; i < n; i++) {
+        counts[0][a[i]]++;
+        counts[0][b[i]]--;
+    }
+    
+#if defined(__AVX2__)
+    for (int c = 0; c < 256; c += 8) {
+        __m256i sum = _mm256_add_epi32(_mm256_load_si256((const __m256i*)(counts[0] + c)),
+                                       _mm256_load_si256((const __m256i*)(counts[1] + c)));
+        sum = _mm256_add_epi32(sum, _mm256_load_si256((const __m256i*)(counts[2] + c)));
+        sum = _mm256_add_epi32(sum, _mm256_load_si256((const __m256i*)(counts[3] + c)));
+        _mm256_store_si256((__m256i*)(counts[0] + c), sum);
+    }
+#else
+    for (int c = 0; c < 256; c++) counts[0][c] += counts[1][c] + counts[2][c] + counts[3][c];
+#endif
+    return histogramsCancel(counts[0]);
+}
+
+/**
+ * anagramSignature - Order-independent 64-bit hash of a word's (case-folded) letters
+ * 
+ * The sum of a fixed random key per character: equal for all anagrams, and
+ * for two different letter multisets equal only by a ~2^-64 coincidence.
+ */
+uint64_t anagramSignature(std::string_view word) {
+    static const std::array<uint64_t, 256> keys = [] {
+        std::array<uint64_t, 256> k{};
+        std::mt19937_64 rng(0x9e3779b97f4a7c15ull);
+        for (auto& key : k) key = rng();
+        return k;
+    }();
+    
+    uint64_t sum = 0;
+    for (unsigned char c : word) sum += keys[FOLD_CASE[c]];
+    
+    // Final mix so the low bits are usable as a table index
+    sum ^= sum >> 31;
+    sum *= 0x7fb5d329728ea185ull;
+    sum ^= sum >> 27;
+    return sum;
+}
+
+/**
+ * groupAnagrams - Partition words into anagram classes
+ * @words: The words to group
+ * 
+ * Returns: One vector of word indices per class, classes ordered by their
+ * first word and indices in increasing order
+ */
+std::vector<std::vector<size_t>> groupAnagrams(const std::vector<std::string>& words) {
+    // Each slot carries its class's first word (as a range of the arena), so
+    // confirming a hit does not touch the word list again
+    struct Slot {
+        uint64_t signature;
+        uint32_t classId;  // UINT32_MAX while empty
+        uint32_t length;
+        size_t offset;
+    };
+    const Slot EMPTY = {0, UINT32_MAX, 0, 0};
+    
+    // The table is sized by the number of classes, not words, so it stays
+    // small enough to be cache resident when most words share classes
+    size_t capacity = 1024;
+    std::vector<Slot> slots(capacity, EMPTY);
+    std::string arena;
+    uint32_t classes = 0;
+    std::vector<uint32_t> classOf(words.size());
+    
+    for (size_t w = 0; w < words.size(); w++) {
+        uint64_t signature = anagramSignature(words[w]);
+        size_t pos = signature & (capacity - 1);
+        for (;; pos = (pos + 1) & (capacity - 1)) {
+            const Slot& slot = slots[pos];
+            if (slot.classId == UINT32_MAX) break;
+            // Equal signatures are confirmed, so a collision only costs a probe
+            if (slot.signature == signature &&
+                areAnagramsFast(std::string_view(arena).substr(slot.offset, slot.length), words[w])) {
+                break;
+            }
+        }
+        if (slots[pos].classId != UINT32_MAX) {
+            classOf[w] = slots[pos].classId;
+            continue;
+        }
+        
+        classOf[w] = classes;
+        slots[pos] = {signature, classes++, (uint32_t)words[w].size(), arena.size()};
+        arena += words[w];
+        if (2 * classes > capacity) {
+            capacity *= 2;
+            std::vector<Slot> grown(capacity, EMPTY);
+            for (const Slot& slot : slots) {
+                if (slot.classId == UINT32_MAX) continue;
+                size_t p = slot.signature & (capacity - 1);
+                while (grown[p].classId != UINT32_MAX) p = (p + 1) & (capacity - 1);
+                grown[p] = slot;
+            }
+            slots.swap(grown);
+        }
+    }
+    
+    // Bucket the indices by class with a counting sort
+    std::vector<size_t> sizes(classes, 0);
+    for (uint32_t c : classOf) sizes[c]++;
+    std::vector<std::vector<size_t>> groups(sizes.size());
+    for (size_t c = 0; c < groups.size(); c++) groups[c].reserve(sizes[c]);
+    for (size_t w = 0; w < words.size(); w++) groups[classOf[w]].push_back(w);
+    return groups;
+}
+
+/**
+ * groupAnagramsBySortedKey - The usual grouping: a hash map keyed by each word's sorted lowercase copy
+ */
+std::vector<std::vector<size_t>> groupAnagramsBySortedKey(const std::vector<std::string>& words) {
+    std::unordered_map<std::string, size_t> classOf;
+    std::vector<std::vector<size_t>> groups;
+    for (size_t w = 0; w < words.size(); w++) {
+        std::string key = words[w];
+        for (char& c : key) c = (char)FOLD_CASE[(unsigned char)c];
+        std::sort(key.begin(), key.end());
+        auto it = classOf.emplace(std::move(key), groups.size()).first;
+        if (it->second == groups.size()) groups.emplace_back();
+        groups[it->second].push_back(w);
+    }
+    return groups;
+}
+
+/**
+ * benchmarkAnagrams - Pairwise checks and batch grouping on random words
+ * @count: Number of words; each is a shuffled, randomly capitalized copy
+ *         of one of count/5 base words, so classes average five words
+ */
+void benchmarkAnagrams(size_t count) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(21);
+    std::vector<std::string> bases(std::max<size_t>(1, count / 5));
+    for (auto& base : bases) {
+        base.resize(3 + rng() % 10);
+        for (char& c : base) c = 'a' + rng() % 26;
+    }
+    std::vector<std::string> words(count);
+    for (auto& word : words) {
+        word = bases[rng() % bases.size()];
+        std::shuffle(word.begin(), word.end(), rng);
+        for (char& c : word) {
+            if (rng() % 4 == 0) c = c - 'a' + 'A';
+        }
+    }
+    
+    // Pairwise: each word against its neighbour (mostly different lengths or letters)
+    std::cout << "Pairwise checks on " << count << " word pairs (M checks/s):" << std::endl;
+    size_t viaSort = 0, viaMap = 0, viaFast = 0;
+    double tSort = timeIt([&] {
+        for (size_t w = 1; w < count; w++) viaSort += areAnagrams(words[w - 1], words[w]);
+    });
+    double tMap = timeIt([&] {
+        for (size_t w = 1; w < count; w++) viaMap += areAnagramsUsingMap(words[w - 1], words[w]);
+    });
+    double tFast = timeIt([&] {
+        for (size_t w = 1; w < count; w++) viaFast += areAnagramsFast(words[w - 1], words[w]);
+    });
+    std::cout << "  sort " << count / tSort * 1e-6 << ", map " << count / tMap * 1e-6 << ", histogram "
+              << count / tFast * 1e-6 << (viaSort == viaMap && viaMap == viaFast ? "" : "  (MISMATCH)")
+              << std::endl;
+    
+    // Long strings: two shuffles of the same 1 MB text
+    std::string longA(1 << 20, 'a');
+    for (char& c : longA) c = 'a' + rng() % 26;
+    std::string longB = longA;
+    std::shuffle(longB.begin(), longB.end(), rng);
+    bool longSort = false, longMap = false, longFast = false;
+    tSort = timeIt([&] { longSort = areAnagrams(longA, longB); });
+    tMap = timeIt([&] { longMap = areAnagramsUsingMap(longA, longB); });
+    tFast = timeIt([&] { longFast = areAnagramsFast(longA, longB); });
+    std::cout << "1 MB anagram pair (MB/s): sort " << 1 / tSort << ", map " << 1 / tMap << ", histogram "
+              << 1 / tFast << (longSort && longMap && longFast ? "" : "  (MISMATCH)") << std::endl;
+    
+    // Batch grouping
+    std::vector<std::vector<size_t>> bySignature, bySortedKey;
+    double tKey = timeIt([&] { bySortedKey = groupAnagramsBySortedKey(words); });
+    double tSignature = timeIt([&] { bySignature = groupAnagrams(words); });
+    std::cout << "Grouping " << count << " words into " << bySignature.size() << " classes: sorted-key map "
+              << tKey * 1e3 << " ms, signature table " << tSignature * 1e3 << " ms"
+              << (bySignature == bySortedKey ? "" : "  (MISMATCH)") << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkAnagrams(argc > 2 ? std::stoul(argv[2]) : 1000000);
+        return 0;
+    }
+    
     // Test strings
     std::string str1 = "Listen";
     std::string str2 = "Silent";
@@ -105,6 +409,17 @@ int main() {
     // Check if strings are anagrams using both methods and display results
     std::cout << "Are anagrams (using sort)? " << (areAnagrams(str1, str2) ? "Yes" : "No") << std::endl;
     std::cout << "Are anagrams (using map)? " << (areAnagramsUsingMap(str1, str2) ? "Yes" : "No") << std::endl;
+    std::cout << "Are anagrams (using histogram)? " << (areAnagramsFast(str1, str2) ? "Yes" : "No") << std::endl;
+    
+    // Group a batch of words into anagram classes
+    std::vector<std::string> words = {"eat", "Tea", "tan", "ate", "nat", "bat"};
+    std::cout << "\nAnagram groups:";
+    for (const auto& group : groupAnagrams(words)) {
+        std::cout << " [";
+        for (size_t k = 0; k < group.size(); k++) std::cout << (k ? " " : "") << words[group[k]];
+        std::cout << "]";
+    }
+    std::cout << std::endl;
     
     return 0;
 }
\ No newline at end of file
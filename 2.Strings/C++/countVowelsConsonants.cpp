@@ -4,19 +4,37 @@
  * This program counts the number of vowels and consonants in a given string.
  * It handles both uppercase and lowercase letters and ignores non-alphabetic characters.
  * 
+ * countVowelsAndConsonants returns a CharClassCounts (see charClass.h) with
+ * digits, whitespace and other bytes counted as well. It classifies bytes
+ * through a 256-entry lookup table, or 32 at a time with an AVX2 nibble
+ * classifier, and CharClassCounter accepts the same input in chunks so large
+ * files can be profiled without loading them whole.
+ * 
  * Time Complexity: O(n) where n is the length of the string
  * Space Complexity: O(1) as we only use a constant amount of extra space
  * 
  * Input: Strings like "Hello World" and "OpenAI GPT"
  * Output: The count of vowels and consonants in each string
+ * 
+ * Benchmark: ./countVowelsConsonants --bench [MB]
+ * File profile: ./countVowelsConsonants --file <path>
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
 #include <cctype>    // For character classification functions (isalpha, tolower)
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "charClass.h"
 
 /**
- * countVowelsAndConsonants - Count the number of vowels and consonants in a string
+ * countVowelsAndConsonantsNaive - Count the number of vowels and consonants in a string
  * @str: The input string (passed by reference for efficiency)
  * 
  * This function iterates through each character of the string, checks if it's an
@@ -27,9 +45,11 @@
  * 
  * Vowels are: a, e, i, o, u (in any case)
  * Consonants are all other alphabetic characters
+ * 
+ * Returns: The counts, with only vowels and consonants filled in
  */
-void countVowelsAndConsonants(const std::string& str) {
-    int vowels = 0, consonants = 0;
+CharClassCounts countVowelsAndConsonantsNaive(const std::string& str) {
+    size_t vowels = 0, consonants = 0;
     
     // Iterate through each character in the string
     for (char c : str) {
@@ -49,20 +69,140 @@ void countVowelsAndConsonants(const std::string& str) {
         // Non-alphabetic characters are ignored
     }
     
-    // Display the results
-    std::cout << "Vowels: " << vowels << "\nConsonants: " << consonants << std::endl;
+    CharClassCounts result;
+    result.vowels = vowels;
+    result.consonants = consonants;
+    return result;
+}
+
+/**
+ * countVowelsAndConsonants - Count vowels, consonants, digits, whitespace and other bytes
+ * @str: The input string
+ * 
+ * Returns: The counts for every class; see countCharClasses in charClass.h
+ */
+CharClassCounts countVowelsAndConsonants(std::string_view str) {
+    return countCharClasses(str);
+}
+
+/**
+ * printCounts - Display the vowel and consonant counts
+ */
+void printCounts(const CharClassCounts& counts) {
+    std::cout << "Vowels: " << counts.vowels << "\nConsonants: " << counts.consonants << std::endl;
+}
+
+/**
+ * profileFile - Count the character classes of a file, reading it in 1 MB blocks
+ * @path: The file to read
+ * @counts: Receives the totals
+ * 
+ * Returns: false if the file cannot be opened
+ */
+bool profileFile(const std::string& path, CharClassCounts& counts) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    
+    CharClassCounter counter;
+    std::vector<char> block(1 << 20);
+    while (in) {
+        in.read(block.data(), block.size());
+        std::streamsize got = in.gcount();
+        if (got <= 0) break;
+        counter.feed(std::string_view(block.data(), (size_t)got));
+    }
+    counts = counter.counts();
+    return true;
+}
+
+/**
+ * benchmarkCharClasses - Compare the counters on random mixed text
+ * @megabytes: Size of the text; it is mostly letters and spaces with some
+ *             digits, punctuation and two-byte UTF-8 sequences
+ */
+void benchmarkCharClasses(size_t megabytes) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    const char alphabet[] = "etaoinshrdlucmfwypvbgkjqxzETAOINSHRDLU     \n0123456789.,;!?-";
+    std::mt19937 rng(17);
+    std::string text(megabytes << 20, ' ');
+    for (size_t i = 0; i < text.size(); i++) {
+        if (rng() % 64 == 0 && i + 1 < text.size()) {
+            text[i++] = (char)0xC3; // é
+            text[i] = (char)0xA9;
+        } else {
+            text[i] = alphabet[rng() % (sizeof(alphabet) - 1)];
+        }
+    }
+    
+    CharClassCounts naive, table, simd, streamed;
+    double tNaive = timeIt([&] { naive = countVowelsAndConsonantsNaive(text); });
+    double tTable = timeIt([&] { table = countCharClassesScalar(text); });
+    double tSimd = timeIt([&] { simd = countCharClasses(text); });
+    double tStream = timeIt([&] {
+        CharClassCounter counter;
+        std::string_view rest(text);
+        while (!rest.empty()) {
+            size_t take = std::min<size_t>(rest.size(), 64 * 1024 + rng() % 64);
+            counter.feed(rest.substr(0, take));
+            rest.remove_prefix(take);
+        }
+        streamed = counter.counts();
+    });
+    
+    bool naiveAgrees = naive.vowels == table.vowels && naive.consonants == table.consonants;
+    bool agree = naiveAgrees && simd == table && streamed == table;
+    double gb = (double)text.size() / 1e9;
+    std::cout << "Counting character classes in " << megabytes << " MB (GB/s):" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  " << std::left << std::setw(28) << "isalpha/tolower loop" << gb / tNaive << std::endl;
+    std::cout << "  " << std::setw(28) << "256-byte table" << gb / tTable << std::endl;
+    std::cout << "  " << std::setw(28) << "countCharClasses" << gb / tSimd << std::endl;
+    std::cout << "  " << std::setw(28) << "CharClassCounter (64 KB)" << gb / tStream
+              << (agree ? "" : "  (MISMATCH)") << std::endl;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkCharClasses(argc > 2 ? std::stoul(argv[2]) : 256);
+        return 0;
+    }
+    if (argc > 2 && std::string(argv[1]) == "--file") {
+        CharClassCounts counts;
+        if (!profileFile(argv[2], counts)) {
+            std::cerr << "Cannot open " << argv[2] << std::endl;
+            return 1;
+        }
+        std::cout << "Vowels: " << counts.vowels << "\nConsonants: " << counts.consonants
+                  << "\nDigits: " << counts.digits << "\nWhitespace: " << counts.spaces
+                  << "\nOther: " << counts.others << std::endl;
+        return 0;
+    }
+    
     // Test with first example string
     std::string str = "Hello World";
     std::cout << "String: " << str << std::endl;
-    countVowelsAndConsonants(str);
+    printCounts(countVowelsAndConsonants(str));
     
     // Test with second example string
     str = "OpenAI GPT";
     std::cout << "\nString: " << str << std::endl;
-    countVowelsAndConsonants(str);
+    printCounts(countVowelsAndConsonants(str));
+    
+    // Streaming input: the same counts arrive whatever the chunking
+    CharClassCounter counter;
+    for (std::string_view chunk : {"The quick brown ", "fox jumps over ", "13 lazy dogs."}) {
+        counter.feed(chunk);
+    }
+    const CharClassCounts& counts = counter.counts();
+    std::cout << "\nStreamed \"The quick brown fox jumps over 13 lazy dogs.\"" << std::endl;
+    std::cout << "Vowels: " << counts.vowels << ", Consonants: " << counts.consonants
+              << ", Digits: " << counts.digits << ", Whitespace: " << counts.spaces
+              << ", Other: " << counts.others << std::endl;
     
     return 0;
 }
\ No newline at end of file
@@ -2,30 +2,48 @@
  * Longest Common Prefix
  * 
  * This program finds the longest common prefix string amongst an array of strings
- * using two different approaches:
+ * using different approaches:
  * 1. Character-by-character comparison
  * 2. Sorting-based approach
+ * 3. Word-at-a-time comparison: each string is compared with the first one
+ *    8 bytes at a time, and the XOR of two words locates the first differing
+ *    byte with a count-trailing-zeros instruction
+ * 4. PrefixIndex: a compact radix trie over a growing set of strings that
+ *    answers the common prefix of any subset of them, and prefix counts
  * 
  * Time Complexity:
  * - Character-by-character: O(S) where S is the sum of all characters in all strings
  * - Sorting-based: O(n log n) for sorting + O(m) for comparison, where n is the number of strings
  *   and m is the length of the shortest string
+ * - Word-at-a-time: O(n × p / 8) where p is the length of the common prefix
+ * - PrefixIndex: O(length) per insert, O(k × h) per k-string subset query where
+ *   h is the height of the trie (short prefixes are compared directly instead)
  * 
  * Space Complexity:
  * - Character-by-character: O(1) extra space
  * - Sorting-based: O(1) extra space if we ignore the sorting space
+ * - Word-at-a-time: O(1) extra space
+ * - PrefixIndex: O(S) for a copy of the strings plus at most 2n trie nodes
  * 
  * Input: Array of strings (e.g., ["flower", "flow", "flight"])
  * Output: The longest common prefix (e.g., "fl")
+ * 
+ * Benchmark: ./longestCommonPrefix --bench [strings]
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
 #include <vector>    // For vector container
 #include <algorithm> // For min and sort functions
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <string_view>
 
 /**
- * longestCommonPrefix - Find the longest common prefix using character-by-character comparison
+ * longestCommonPrefixNaive - Find the longest common prefix using character-by-character comparison
  * @strs: Vector of strings to compare
  * 
  * This function compares characters at the same position across all strings.
@@ -34,7 +52,7 @@
  * 
  * Returns: The longest common prefix as a string
  */
-std::string longestCommonPrefix(const std::vector<std::string>& strs) {
+std::string longestCommonPrefixNaive(const std::vector<std::string>& strs) {
     // Handle edge cases
     if (strs.empty()) return "";  // Empty array
     if (strs.size() == 1) return strs[0];  // Single string is its own prefix
@@ -97,7 +115,379 @@ std::string longestCommonPrefixUsingSorting(std::vector<std::string> strs) {
     return first.substr(0, i);
 }
 
-int main() {
+/**
+ * commonPrefixLength - Length of the common prefix of two strings, 8 bytes per step
+ * @a: First string
+ * @b: Second string
+ * 
+ * Loads a word from each string and XORs them; the lowest set bit of a
+ * nonzero XOR is in the first differing byte (words are loaded little-endian).
+ * 
+ * Returns: The number of leading bytes a and b share
+ */
+size_t commonPrefixLength(std::string_view a, std::string_view b) {
+    size_t n = std::min(a.size(), b.size());
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x, y;
+        std::memcpy(&x, a.data() + i, 8);
+        std::memcpy(&y, b.data() + i, 8);
+        if (uint64_t diff = x ^ y) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return i + __builtin_clzll(diff) / 8;
+#else
+            return i + __builtin_ctzll(diff) / 8;
+#endif
+        }
+    }
+    while (i < n && a[i] == b[i]) i++;
+    return i;
+}
+
+/**
+ * longestCommonPrefix - Find the longest common prefix with the word-at-a-time kernel
+ * @strs: Vector of strings to compare
+ * 
+ * Shrinks the prefix of the first string by comparing it with every other
+ * string, and stops early once it is empty.
+ * 
+ * Returns: The longest common prefix as a string
+ */
+std::string longestCommonPrefix(const std::vector<std::string>& strs) {
+    if (strs.empty()) return "";
+    
+    std::string_view prefix = strs[0];
+    for (size_t k = 1; k < strs.size() && !prefix.empty(); k++) {
+        prefix = prefix.substr(0, commonPrefixLength(prefix, strs[k]));
+    }
+    return std::string(prefix);
+}
+
+/**
+ * PrefixIndex - Compact radix trie over a growing set of strings
+ * 
+ * Every inserted string gets an id (0, 1, 2, ...) and is copied into one
+ * shared arena. Each trie node stands for the prefix of length depth of the
+ * strings below it; its incoming edge is the byte range [parent depth,
+ * depth) of one of those strings (ref), so labels are never stored twice.
+ * Nodes only exist where strings branch or end, so n strings need at most
+ * 2n + 1 nodes. Children are found through one open-addressing table keyed
+ * by (node, first byte of the edge), so a step down costs one probe no
+ * matter how many siblings a node has.
+ * 
+ * The common prefix of a subset of strings is the path to the lowest common
+ * ancestor of their end nodes. String depth strictly increases down the
+ * trie, so the ancestor is found by repeatedly moving the deeper of two
+ * nodes to its parent; parents and depths are packed together so that the
+ * climb stays in cache. Each node also counts the strings at or below it,
+ * which answers "how many strings start with p".
+ */
+class PrefixIndex {
+public:
+    // Prefixes up to this long are compared directly rather than via the trie
+    static constexpr size_t PREFIX_SCAN_LIMIT = 256;
+    
+    PrefixIndex() {
+        links_.push_back({NONE, 0});
+        ref_.push_back(0);
+        count_.push_back(0);
+        edges_.assign(1024, Edge());
+    }
+    
+    size_t size() const { return ends_.size(); }
+    size_t nodeCount() const { return links_.size(); }
+    
+    /**
+     * get - The string with the given id
+     * 
+     * The view stays valid until the next insert.
+     */
+    std::string_view get(size_t id) const {
+        return std::string_view(arena_).substr(offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+    
+    /**
+     * insert - Add a string to the set
+     * @s: The string; duplicates get their own ids
+     * 
+     * Returns: The id of the new string
+     */
+    size_t insert(std::string_view s) {
+        uint32_t id = (uint32_t)ends_.size();
+        arena_.append(s.data(), s.size());
+        offsets_.push_back(arena_.size());
+        s = get(id); // s may have pointed into the arena before it grew
+        allLcp_ = id == 0 ? s.size() : commonPrefixLength(get(0).substr(0, allLcp_), s);
+        
+        uint32_t node = 0;
+        count_[0]++;
+        size_t pos = 0;
+        while (pos < s.size()) {
+            unsigned char c = (unsigned char)s[pos];
+            uint32_t child = findChild(node, c);
+            if (child == NONE) {
+                child = addNode(node, c, id, (uint32_t)s.size());
+                count_[child]++;
+                node = child;
+                break;
+            }
+            
+            // Follow the edge as far as s agrees with it
+            size_t edgeEnd = links_[child].depth;
+            std::string_view label = get(ref_[child]).substr(pos, edgeEnd - pos);
+            size_t matched = commonPrefixLength(s.substr(pos), label);
+            if (pos + matched < edgeEnd) {
+                child = splitEdge(node, c, child, (uint32_t)(pos + matched));
+            }
+            count_[child]++;
+            node = child;
+            pos += matched;
+        }
+        
+        ends_.push_back(node);
+        return id;
+    }
+    
+    /**
+     * lcpLength - Length of the longest common prefix of a subset of the strings
+     * @ids: Ids returned by insert; an empty subset has prefix length 0
+     * 
+     * While the prefix is longer than PREFIX_SCAN_LIMIT the trie is climbed,
+     * which costs O(h) whatever the string lengths; once it is short, the
+     * remaining strings are compared with the first one directly, which
+     * costs one arena access each instead of one per trie level.
+     */
+    size_t lcpLength(const std::vector<size_t>& ids) const {
+        if (ids.empty()) return 0;
+        uint32_t ancestor = ends_[ids[0]];
+        size_t k = 1;
+        for (; k < ids.size() && links_[ancestor].depth > PREFIX_SCAN_LIMIT; k++) {
+            ancestor = lowestCommonAncestor(ancestor, ends_[ids[k]]);
+        }
+        
+        std::string_view first = get(ids[0]);
+        size_t length = links_[ancestor].depth;
+        for (; k < ids.size() && length > 0; k++) {
+            length = commonPrefixLength(first.substr(0, length), get(ids[k]));
+        }
+        return length;
+    }
+    
+    /**
+     * lcp - The longest common prefix of a subset of the strings
+     */
+    std::string lcp(const std::vector<size_t>& ids) const {
+        if (ids.empty()) return "";
+        return std::string(get(ids[0]).substr(0, lcpLength(ids)));
+    }
+    
+    /**
+     * lcpLengthAll - Length of the longest common prefix of every string inserted so far
+     */
+    size_t lcpLengthAll() const { return allLcp_; }
+    
+    /**
+     * countWithPrefix - Number of inserted strings that start with prefix
+     */
+    size_t countWithPrefix(std::string_view prefix) const {
+        uint32_t node = 0;
+        size_t pos = 0;
+        while (pos < prefix.size()) {
+            uint32_t child = findChild(node, (unsigned char)prefix[pos]);
+            if (child == NONE) return 0;
+            size_t want = std::min<size_t>(links_[child].depth, prefix.size()) - pos;
+            std::string_view label = get(ref_[child]).substr(pos, want);
+            if (commonPrefixLength(prefix.substr(pos, want), label) < want) return 0;
+            node = child;
+            pos += want;
+        }
+        return count_[node];
+    }
+    
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    
+    struct Link {
+        uint32_t parent;
+        uint32_t depth; // Length of the prefix the node stands for
+    };
+    
+    struct Edge {
+        uint64_t key = 0; // node * 256 + first byte + 1, 0 when the slot is free
+        uint32_t child = NONE;
+    };
+    
+    static uint64_t edgeKey(uint32_t node, unsigned char c) { return ((uint64_t)node << 8) + c + 1; }
+    
+    size_t slotOf(uint64_t key) const {
+        size_t mask = edges_.size() - 1;
+        size_t slot = (size_t)(key * 0x9E3779B97F4A7C15ULL >> 20) & mask;
+        while (edges_[slot].key != 0 && edges_[slot].key != key) slot = (slot + 1) & mask;
+        return slot;
+    }
+    
+    uint32_t findChild(uint32_t node, unsigned char c) const {
+        return edges_[slotOf(edgeKey(node, c))].child;
+    }
+    
+    void setChild(uint32_t node, unsigned char c, uint32_t child) {
+        size_t slot = slotOf(edgeKey(node, c));
+        if (edges_[slot].key == 0) {
+            if (2 * (edgeCount_ + 1) > edges_.size()) {
+                growEdges();
+                slot = slotOf(edgeKey(node, c));
+            }
+            edgeCount_++;
+        }
+        edges_[slot].key = edgeKey(node, c);
+        edges_[slot].child = child;
+    }
+    
+    void growEdges() {
+        std::vector<Edge> old(edges_.size() * 2);
+        old.swap(edges_);
+        for (const Edge& e : old) {
+            if (e.key != 0) edges_[slotOf(e.key)] = e;
+        }
+    }
+    
+    uint32_t addNode(uint32_t parent, unsigned char first, uint32_t ref, uint32_t depth) {
+        uint32_t id = (uint32_t)links_.size();
+        links_.push_back({parent, depth});
+        ref_.push_back(ref);
+        count_.push_back(0);
+        setChild(parent, first, id);
+        return id;
+    }
+    
+    // Insert a node of the given depth on the edge parent -> child, whose first byte is first
+    uint32_t splitEdge(uint32_t parent, unsigned char first, uint32_t child, uint32_t depth) {
+        uint32_t mid = addNode(parent, first, ref_[child], depth);
+        count_[mid] = count_[child];
+        links_[child].parent = mid;
+        setChild(mid, (unsigned char)get(ref_[child])[depth], child);
+        return mid;
+    }
+    
+    uint32_t lowestCommonAncestor(uint32_t a, uint32_t b) const {
+        while (a != b) {
+            Link la = links_[a], lb = links_[b];
+            if (la.depth >= lb.depth) a = la.parent;
+            if (lb.depth >= la.depth) b = lb.parent;
+        }
+        return a;
+    }
+    
+    std::vector<Link> links_;                // Parent and depth of each node
+    std::vector<uint32_t> ref_;              // Id of a string whose prefix the node is
+    std::vector<uint32_t> count_;            // Strings ending at or below the node
+    std::vector<Edge> edges_;                // (node, byte) -> child, power-of-two size
+    size_t edgeCount_ = 0;
+    std::vector<uint32_t> ends_;             // End node of each string id
+    std::string arena_;                      // All strings, back to back
+    std::vector<size_t> offsets_ = {0};      // String id k is arena_[offsets_[k], offsets_[k+1])
+    size_t allLcp_ = 0;
+};
+
+/**
+ * benchmarkPrefixSet - Whole-set and subset prefix queries on one set of strings
+ * @strs: The strings
+ * @rng: Source of the random subsets
+ * 
+ * Every answer from PrefixIndex is cross-checked against the scanning versions.
+ */
+void benchmarkPrefixSet(const std::vector<std::string>& strs, std::mt19937& rng) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    size_t count = strs.size();
+    
+    std::cout << "Whole set of " << count << " strings:" << std::endl;
+    std::string naive, sorted, kernel;
+    double tNaive = timeIt([&] { naive = longestCommonPrefixNaive(strs); });
+    double tSorted = timeIt([&] { sorted = longestCommonPrefixUsingSorting(strs); });
+    double tKernel = timeIt([&] { kernel = longestCommonPrefix(strs); });
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  character-by-character " << tNaive * 1e3 << " ms, sorting " << tSorted * 1e3
+              << " ms, word-at-a-time " << tKernel * 1e3 << " ms, prefix " << kernel.size() << " bytes"
+              << (naive == sorted && sorted == kernel ? "" : "  (MISMATCH)") << std::endl;
+    
+    PrefixIndex index;
+    double tBuild = timeIt([&] {
+        for (const auto& s : strs) index.insert(s);
+    });
+    std::cout << "  PrefixIndex: " << tBuild * 1e3 << " ms to insert (" << index.nodeCount() << " nodes), lcp "
+              << (index.lcpLengthAll() == kernel.size() ? "matches" : "(MISMATCH)") << std::endl;
+    
+    // Random subsets: copy-and-scan versus the index
+    const size_t queries = 200000, subsetSize = 16;
+    std::vector<std::vector<size_t>> subsets(queries, std::vector<size_t>(subsetSize));
+    for (auto& subset : subsets) {
+        // Half the queries stay within one host directory, so their prefixes are long
+        size_t base = rng() % count;
+        for (auto& id : subset) id = rng() % 2 ? (base + rng() % 64) % count : rng() % count;
+    }
+    size_t scanTotal = 0, indexTotal = 0, longPrefixes = 0;
+    double tScan = timeIt([&] {
+        std::vector<std::string> picked;
+        for (const auto& subset : subsets) {
+            picked.clear();
+            for (size_t id : subset) picked.push_back(strs[id]);
+            size_t length = longestCommonPrefixNaive(picked).size();
+            scanTotal += length;
+            longPrefixes += length > PrefixIndex::PREFIX_SCAN_LIMIT;
+        }
+    });
+    double tIndex = timeIt([&] {
+        for (const auto& subset : subsets) indexTotal += index.lcpLength(subset);
+    });
+    std::cout << queries << " subset queries of " << subsetSize << " strings (" << longPrefixes
+              << " answered by the trie climb alone): copy and scan " << tScan * 1e3 << " ms, PrefixIndex "
+              << tIndex * 1e3 << " ms" << (scanTotal == indexTotal ? "" : "  (MISMATCH)") << std::endl;
+    std::cout.unsetf(std::ios::fixed);
+}
+
+/**
+ * benchmarkPrefixes - Prefix queries on short and on deeply nested path-like strings
+ * @count: Number of short strings, e.g. "/srv/data/region-3/host-0042/2024/07/x9fk2"
+ * 
+ * The short paths share about 20 bytes, so subset queries mostly take the
+ * direct comparison in lcpLength. The second set (count / 4 strings) puts
+ * the same tails under a common directory more than PREFIX_SCAN_LIMIT bytes
+ * deep, so the trie climb does the work; one string in 64 branches off at
+ * byte 100 instead, which makes those subsets cut over to direct comparison
+ * part-way through.
+ */
+void benchmarkPrefixes(size_t count) {
+    std::mt19937 rng(20);
+    auto tail = [&] {
+        std::string s = "/region-" + std::to_string(rng() % 4) + "/host-" + std::to_string(rng() % 1000) + "/2024/" +
+                        std::to_string(1 + rng() % 12) + "/";
+        for (int k = 0; k < 6; k++) s += "abcdefghijklmnopqrstuvwxyz0123456789"[rng() % 36];
+        return s;
+    };
+    
+    std::vector<std::string> strs(count);
+    for (auto& s : strs) s = "/srv/data" + tail();
+    benchmarkPrefixSet(strs, rng);
+    
+    std::string deep = "/mnt/build";
+    for (int level = 0; level < 32; level++) deep += "/stage-" + std::to_string(level);
+    std::string branch = deep.substr(0, 100) + "/archive";
+    std::vector<std::string> deepStrs(std::max<size_t>(count / 4, 1));
+    for (auto& s : deepStrs) s = (rng() % 64 ? deep : branch) + tail();
+    std::cout << "\nUnder a " << deep.size() << "-byte directory:" << std::endl;
+    benchmarkPrefixSet(deepStrs, rng);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkPrefixes(argc > 2 ? std::stoul(argv[2]) : 1000000);
+        return 0;
+    }
+    
     // Test array of strings
     std::vector<std::string> strs = {"flower", "flow", "flight"};
     
@@ -108,8 +498,20 @@ int main() {
     }
     
     // Find and display the longest common prefix using both methods
-    std::cout << "\nLongest common prefix: " << longestCommonPrefix(strs) << std::endl;
+    std::cout << "\nLongest common prefix: " << longestCommonPrefixNaive(strs) << std::endl;
     std::cout << "Using sorting method: " << longestCommonPrefixUsingSorting(strs) << std::endl;
+    std::cout << "Using word-at-a-time method: " << longestCommonPrefix(strs) << std::endl;
+    
+    // Subset queries against an index that keeps growing
+    PrefixIndex index;
+    for (const auto& str : strs) index.insert(str);
+    size_t flowers = index.insert("flowers");
+    size_t floral = index.insert("floral");
+    std::cout << "\nIndexed " << index.size() << " strings" << std::endl;
+    std::cout << "Common prefix of flower, flowers: " << index.lcp({0, flowers}) << std::endl;
+    std::cout << "Common prefix of flow, floral: " << index.lcp({1, floral}) << std::endl;
+    std::cout << "Common prefix of all: " << index.lcp({0, 1, 2, flowers, floral}) << std::endl;
+    std::cout << "Strings starting with \"flow\": " << index.countWithPrefix("flow") << std::endl;
     
     return 0;
 }
\ No newline at end of file
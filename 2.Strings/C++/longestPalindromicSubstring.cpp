@@ -1,27 +1,41 @@
 /**
  * Longest Palindromic Substring
  * 
- * This program finds the longest palindromic substring in a given string using two different approaches:
- * 1. Expand Around Center - For each character, expand outward to find palindromes
- * 2. Dynamic Programming - Build a table to track palindromic substrings
+ * This program finds the longest palindromic substring in a given string using three different approaches:
+ * 1. Manacher's algorithm (default) - Reuse palindromes already found to get every center's radius in O(n)
+ * 2. Expand Around Center - For each character, expand outward to find palindromes
+ * 3. Dynamic Programming - Build a table to track palindromic substrings (one row at a time)
  * 
  * A palindrome is a string that reads the same backward as forward (e.g., "racecar", "madam")
  * 
+ * The radius arrays computed by Manacher's algorithm (PalindromeRadii) also answer
+ * "is s[l..r] a palindrome" in O(1), list every maximal palindrome, and, with
+ * PalindromeRangeIndex, find the longest palindrome inside any range [l, r] in O(log n).
+ * 
  * Time Complexity:
- * - Expand Around Center: O(n²) where n is the length of the string
+ * - Manacher: O(n) where n is the length of the string
+ * - Expand Around Center: O(n²) where n is the length of the string (e.g. "aaaa...")
  * - Dynamic Programming: O(n²) where n is the length of the string
  * 
  * Space Complexity:
+ * - Manacher: O(n) for the two radius arrays
  * - Expand Around Center: O(1) as we only use a constant amount of extra space
- * - Dynamic Programming: O(n²) for the DP table
+ * - Dynamic Programming: O(n) for one row of the DP table
  * 
  * Input: A string (e.g., "babad")
  * Output: The longest palindromic substring (e.g., "bab" or "aba")
+ * 
+ * Benchmark: ./longestPalindromicSubstring --bench [n]
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
-#include <vector>    // For the 2D vector in DP approach
+#include <vector>    // For the radius arrays and the DP row
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <stdexcept>
 
 /**
  * expandAroundCenter - Helper function to expand around a center point
@@ -54,7 +68,7 @@ void expandAroundCenter(const std::string& s, int left, int right, int& start, i
 }
 
 /**
- * longestPalindromicSubstring - Find the longest palindromic substring using expand around center
+ * longestPalindromicSubstringExpand - Find the longest palindromic substring using expand around center
  * @s: The input string
  * 
  * This function uses the expand around center approach to find the longest palindromic substring.
@@ -64,7 +78,7 @@ void expandAroundCenter(const std::string& s, int left, int right, int& start, i
  * 
  * Returns: The longest palindromic substring
  */
-std::string longestPalindromicSubstring(const std::string& s) {
+std::string longestPalindromicSubstringExpand(const std::string& s) {
     // Handle base case: empty string or single character
     if (s.length() < 2) return s;
     
@@ -90,52 +104,38 @@ std::string longestPalindromicSubstring(const std::string& s) {
  * @s: The input string
  * 
  * This function uses a dynamic programming approach to find the longest palindromic substring.
- * It builds a 2D table where dp[i][j] is true if the substring s[i..j] is a palindrome.
+ * dp[i][j] is true if the substring s[i..j] is a palindrome.
  * 
  * The key insight is that a substring is a palindrome if:
  * 1. The first and last characters match (s[i] == s[j])
  * 2. The substring between them is also a palindrome (dp[i+1][j-1] is true)
  * 
+ * Row i only depends on row i+1, so the rows are computed from the bottom up
+ * in a single reused row: walking j downwards, row[j-1] still holds
+ * dp[i+1][j-1] when row[j] is overwritten. That keeps memory at O(n) instead
+ * of an n×n table.
+ * 
  * Returns: The longest palindromic substring
  */
 std::string longestPalindromicSubstringDP(const std::string& s) {
     int n = s.length();
     if (n < 2) return s;  // Handle base case
     
-    // dp[i][j] represents whether s[i..j] is a palindrome
-    std::vector<std::vector<bool>> dp(n, std::vector<bool>(n, false));
-    
-    // All substrings of length 1 are palindromes
-    for (int i = 0; i < n; i++) {
-        dp[i][i] = true;
-    }
+    // row[j] holds dp[i][j] for the current i (and dp[i+1][j] before it is overwritten)
+    std::vector<char> row(n, 0);
     
     int start = 0;   // Start index of the longest palindrome
     int maxLen = 1;  // Length of the longest palindrome
     
-    // Check for substrings of length 2
-    for (int i = 0; i < n - 1; i++) {
-        if (s[i] == s[i + 1]) {
-            dp[i][i + 1] = true;
-            start = i;
-            maxLen = 2;
-        }
-    }
-    
-    // Check for lengths greater than 2
-    // We build the table diagonally (by substring length)
-    for (int len = 3; len <= n; len++) {
-        for (int i = 0; i < n - len + 1; i++) {
-            int j = i + len - 1;  // Ending index of the substring
+    for (int i = n - 1; i >= 0; i--) {
+        for (int j = n - 1; j >= i; j--) {
+            // Lengths 1 and 2 only need matching ends; longer ones also need the inside
+            row[j] = s[i] == s[j] && (j - i < 2 || row[j - 1]);
             
-            // A substring is a palindrome if the first and last characters match
-            // and the substring between them is also a palindrome
-            if (s[i] == s[j] && dp[i + 1][j - 1]) {
-                dp[i][j] = true;
-                if (len > maxLen) {
-                    start = i;
-                    maxLen = len;
-                }
+            int len = j - i + 1;
+            if (row[j] && (len > maxLen || (len == maxLen && i < start))) {
+                start = i;
+                maxLen = len;
             }
         }
     }
@@ -144,18 +144,272 @@ std::string longestPalindromicSubstringDP(const std::string& s) {
     return s.substr(start, maxLen);
 }
 
-int main() {
+/**
+ * PalindromeRadii - Radius of the longest palindrome around every center (Manacher's algorithm)
+ * 
+ * odd[i] = k means s[i-k+1 .. i+k-1] (length 2k-1) is the longest odd
+ * palindrome centered on character i; even[i] = k means s[i-k .. i+k-1]
+ * (length 2k) is the longest even palindrome centered between i-1 and i.
+ * 
+ * Both arrays are filled left to right. The rightmost palindrome found so far,
+ * s[l..r], mirrors every center inside it: the radius at i is at least the
+ * radius at its mirror l + r - i (clipped to r), so characters are only
+ * compared beyond r and r never moves left, which makes the total work O(n).
+ */
+class PalindromeRadii {
+public:
+    struct Palindrome {
+        int start;
+        int length;
+    };
+    
+    explicit PalindromeRadii(const std::string& s) : n_(s.length()), odd_(n_), even_(n_) {
+        for (int i = 0, l = 0, r = -1; i < n_; i++) {
+            int k = i > r ? 1 : std::min(odd_[l + r - i], r - i + 1);
+            while (i - k >= 0 && i + k < n_ && s[i - k] == s[i + k]) k++;
+            odd_[i] = k;
+            if (i + k - 1 > r) {
+                l = i - k + 1;
+                r = i + k - 1;
+            }
+        }
+        for (int i = 0, l = 0, r = -1; i < n_; i++) {
+            int k = i > r ? 0 : std::min(even_[l + r - i + 1], r - i + 1);
+            while (i - k - 1 >= 0 && i + k < n_ && s[i - k - 1] == s[i + k]) k++;
+            even_[i] = k;
+            if (i + k - 1 > r) {
+                l = i - k;
+                r = i + k - 1;
+            }
+        }
+    }
+    
+    int size() const { return n_; }
+    const std::vector<int>& odd() const { return odd_; }
+    const std::vector<int>& even() const { return even_; }
+    
+    /**
+     * longest - The longest palindromic substring (the leftmost one on ties)
+     */
+    Palindrome longest() const {
+        Palindrome best = {0, 0};
+        for (int i = 0; i < n_; i++) {
+            Palindrome odd = {i - odd_[i] + 1, 2 * odd_[i] - 1};
+            Palindrome even = {i - even_[i], 2 * even_[i]};
+            for (const Palindrome& p : {odd, even}) {
+                if (p.length > best.length || (p.length == best.length && p.start < best.start)) best = p;
+            }
+        }
+        return best;
+    }
+    
+    /**
+     * isPalindrome - Whether s[l..r] (inclusive) is a palindrome, in O(1)
+     */
+    bool isPalindrome(int l, int r) const {
+        if (l < 0 || r >= n_ || l > r) throw std::out_of_range("Palindrome query out of range");
+        int len = r - l + 1;
+        int center = (l + r + 1) / 2;
+        return len % 2 ? 2 * odd_[center] - 1 >= len : 2 * even_[center] >= len;
+    }
+    
+    /**
+     * maximalPalindromes - The longest palindrome around every center, left to right
+     * 
+     * A string of length n has 2n-1 centers; centers between two different
+     * characters have no palindrome and are skipped. Every palindromic
+     * substring is a centered part of one of these.
+     */
+    std::vector<Palindrome> maximalPalindromes() const {
+        std::vector<Palindrome> out;
+        out.reserve(2 * n_);
+        for (int i = 0; i < n_; i++) {
+            if (even_[i] > 0) out.push_back({i - even_[i], 2 * even_[i]});
+            out.push_back({i - odd_[i] + 1, 2 * odd_[i] - 1});
+        }
+        return out;
+    }
+    
+    /**
+     * countPalindromicSubstrings - Number of (start, end) pairs that are palindromes
+     */
+    long long countPalindromicSubstrings() const {
+        long long total = 0;
+        for (int i = 0; i < n_; i++) total += odd_[i] + even_[i];
+        return total;
+    }
+    
+private:
+    int n_;
+    std::vector<int> odd_;
+    std::vector<int> even_;
+};
+
+/**
+ * PalindromeRangeIndex - Longest palindrome inside any range [l, r], in O(log n) per query
+ * 
+ * An odd palindrome of length 2k-1 fits in [l, r] iff some center c in
+ * [l+k-1, r-k+1] has odd[c] >= k (and likewise for even lengths). Shrinking a
+ * palindrome by one character on each side leaves a palindrome, so the answer
+ * is monotone in k and can be binary searched, with each probe a range-maximum
+ * query answered in O(1) by a sparse table. The tables take O(n log n) memory,
+ * which is why they live here and not in PalindromeRadii.
+ */
+class PalindromeRangeIndex {
+public:
+    explicit PalindromeRangeIndex(const PalindromeRadii& radii)
+        : radii_(radii), oddMax_(buildSparseTable(radii.odd())), evenMax_(buildSparseTable(radii.even())) {}
+    
+    /**
+     * longestInRange - Longest palindrome fully inside s[l..r] (inclusive; leftmost on ties)
+     */
+    PalindromeRadii::Palindrome longestInRange(int l, int r) const {
+        if (l < 0 || r >= radii_.size() || l > r) throw std::out_of_range("Palindrome query out of range");
+        
+        // Largest k with an odd palindrome of length 2k-1 inside [l, r]
+        int lo = 1, hi = (r - l + 2) / 2;
+        while (lo < hi) {
+            int k = (lo + hi + 1) / 2;
+            if (rangeMax(oddMax_, l + k - 1, r - k + 1) >= k) lo = k; else hi = k - 1;
+        }
+        int oddK = lo;
+        
+        // Largest k with an even palindrome of length 2k inside [l, r] (centers l+k .. r-k+1)
+        lo = 0;
+        hi = (r - l + 1) / 2;
+        while (lo < hi) {
+            int k = (lo + hi + 1) / 2;
+            if (rangeMax(evenMax_, l + k, r - k + 1) >= k) lo = k; else hi = k - 1;
+        }
+        int evenK = lo;
+        
+        // Locate the leftmost center that reaches the winning length: binary
+        // search for the shortest prefix of the center range whose maximum is >= k
+        bool useEven = 2 * evenK > 2 * oddK - 1;
+        int k = useEven ? evenK : oddK;
+        const SparseTable& table = useEven ? evenMax_ : oddMax_;
+        int first = useEven ? l + k : l + k - 1;
+        int c = first, last = r - k + 1;
+        while (c < last) {
+            int mid = c + (last - c) / 2;
+            if (rangeMax(table, first, mid) >= k) last = mid; else c = mid + 1;
+        }
+        return useEven ? PalindromeRadii::Palindrome{c - k, 2 * k} : PalindromeRadii::Palindrome{c - k + 1, 2 * k - 1};
+    }
+    
+private:
+    using SparseTable = std::vector<std::vector<int>>;
+    
+    static SparseTable buildSparseTable(const std::vector<int>& values) {
+        SparseTable table(1, values);
+        for (size_t w = 1; 2 * w <= values.size(); w *= 2) {
+            const std::vector<int>& prev = table.back();
+            std::vector<int> level(values.size() - 2 * w + 1);
+            for (size_t i = 0; i < level.size(); i++) level[i] = std::max(prev[i], prev[i + w]);
+            table.push_back(std::move(level));
+        }
+        return table;
+    }
+    
+    // Maximum of values[a..b]; 0 for an empty range
+    static int rangeMax(const SparseTable& table, int a, int b) {
+        if (a > b) return 0;
+        int level = 31 - __builtin_clz((unsigned)(b - a + 1));
+        return std::max(table[level][a], table[level][b - (1 << level) + 1]);
+    }
+    
+    const PalindromeRadii& radii_;
+    SparseTable oddMax_;
+    SparseTable evenMax_;
+};
+
+/**
+ * longestPalindromicSubstring - Find the longest palindromic substring using Manacher's algorithm
+ * @s: The input string
+ * 
+ * Returns: The longest palindromic substring (the leftmost one if several have the same length)
+ */
+std::string longestPalindromicSubstring(const std::string& s) {
+    PalindromeRadii::Palindrome best = PalindromeRadii(s).longest();
+    return s.substr(best.start, best.length);
+}
+
+/**
+ * benchmarkPalindromes - Compare the three approaches on adversarial and random inputs
+ * @maxN: Largest input length; the quadratic approaches stop at 50000
+ */
+void benchmarkPalindromes(int maxN) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(3);
+    std::cout << "input          n      Manacher ms   expand ms     DP ms" << std::endl;
+    for (int n = 1000; n <= maxN; n *= 10) {
+        std::string random(n, 'a');
+        for (char& c : random) c = 'a' + rng() % 2;
+        std::string abab(n, 'a');
+        for (int i = 1; i < n; i += 2) abab[i] = 'b';
+        
+        struct Input { const char* name; std::string text; };
+        for (const Input& in : {Input{"aaaa...", std::string(n, 'a')}, Input{"abab...", abab}, Input{"random a/b", random}}) {
+            std::string viaManacher, viaExpand, viaDp;
+            double tManacher = timeIt([&] { viaManacher = longestPalindromicSubstring(in.text); });
+            bool quadratic = n <= 50000;
+            double tExpand = quadratic ? timeIt([&] { viaExpand = longestPalindromicSubstringExpand(in.text); }) : -1;
+            double tDp = quadratic ? timeIt([&] { viaDp = longestPalindromicSubstringDP(in.text); }) : -1;
+            bool ok = !quadratic || (viaManacher == viaExpand && viaManacher == viaDp);
+            
+            std::cout << std::left << std::setw(12) << in.name << std::right << std::setw(9) << n << std::fixed
+                      << std::setprecision(2) << std::setw(14) << tManacher * 1e3;
+            if (quadratic) {
+                std::cout << std::setw(12) << tExpand * 1e3 << std::setw(10) << tDp * 1e3;
+            } else {
+                std::cout << std::setw(12) << "-" << std::setw(10) << "-";
+            }
+            std::cout << std::defaultfloat << (ok ? "" : "  (MISMATCH)") << std::endl;
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkPalindromes(argc > 2 ? std::stoi(argv[2]) : 1000000);
+        return 0;
+    }
+    
     // Test string
     std::string str = "babad";
     std::cout << "Original string: " << str << std::endl;
     
+    // Find longest palindromic substring using Manacher's algorithm
+    std::string result0 = longestPalindromicSubstring(str);
+    std::cout << "Longest palindromic substring (Manacher): " << result0 << std::endl;
+    
     // Find longest palindromic substring using expand around center approach
-    std::string result1 = longestPalindromicSubstring(str);
+    std::string result1 = longestPalindromicSubstringExpand(str);
     std::cout << "Longest palindromic substring (expand around center): " << result1 << std::endl;
     
     // Find longest palindromic substring using dynamic programming approach
     std::string result2 = longestPalindromicSubstringDP(str);
     std::cout << "Longest palindromic substring (dynamic programming): " << result2 << std::endl;
     
+    // Queries answered from the same radius arrays
+    std::string text = "abacdfgdcabaracecar";
+    PalindromeRadii radii(text);
+    PalindromeRangeIndex ranges(radii);
+    std::cout << "\nText: " << text << std::endl;
+    std::cout << "Palindromic substrings: " << radii.countPalindromicSubstrings() << std::endl;
+    std::cout << "Maximal palindromes longer than 2:";
+    for (const auto& p : radii.maximalPalindromes()) {
+        if (p.length > 2) std::cout << " " << text.substr(p.start, p.length) << "@" << p.start;
+    }
+    std::cout << std::endl;
+    std::cout << "Is text[12..18] a palindrome? " << (radii.isPalindrome(12, 18) ? "yes" : "no") << std::endl;
+    auto inRange = ranges.longestInRange(0, 12);
+    std::cout << "Longest palindrome in text[0..12]: " << text.substr(inRange.start, inRange.length) << std::endl;
+    
     return 0;
 }
\ No newline at end of file
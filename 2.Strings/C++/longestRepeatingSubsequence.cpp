@@ -11,20 +11,34 @@
  * The problem is solved using dynamic programming, similar to the Longest Common Subsequence (LCS)
  * problem, but with the constraint that the same character at the same position cannot be used twice.
  * 
- * Time Complexity: O(n²) where n is the length of the string
- * Space Complexity: O(n²) for the DP table
+ * Row i of the DP table only depends on row i-1, so the length needs just two
+ * rows, and the subsequence itself is rebuilt with Hirschberg's divide and
+ * conquer (split the rows in half, find where the optimal path crosses the
+ * middle from a forward and a backward pass, recurse on both halves) instead
+ * of backtracking through a stored table. The length can also be computed
+ * bit-parallel, 64 table cells per machine word.
+ * 
+ * Time Complexity: O(n²) where n is the length of the string (O(n²/64) bit-parallel)
+ * Space Complexity: O(n) for the rolling rows and for Hirschberg; O(n²) for the
+ *                   original full-table versions (the *Naive functions)
  * 
  * Input: A string (e.g., "AABEBCDD")
  * Output: Length of the longest repeating subsequence and one possible subsequence
+ * 
+ * Benchmark: ./longestRepeatingSubsequence --bench [n]
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
 #include <vector>    // For 2D vector (DP table)
 #include <algorithm> // For max function
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <random>
 
 /**
- * longestRepeatingSubsequence - Find the length of the longest repeating subsequence
+ * longestRepeatingSubsequenceNaive - Find the length of the longest repeating subsequence
  * @str: The input string
  * 
  * This function uses dynamic programming to find the length of the longest repeating subsequence.
@@ -39,7 +53,7 @@
  * 
  * Returns: The length of the longest repeating subsequence
  */
-int longestRepeatingSubsequence(const std::string& str) {
+int longestRepeatingSubsequenceNaive(const std::string& str) {
     int n = str.length();
     // Create a DP table of size (n+1) x (n+1), initialized with zeros
     std::vector<std::vector<int>> dp(n + 1, std::vector<int>(n + 1, 0));
@@ -63,7 +77,7 @@ int longestRepeatingSubsequence(const std::string& str) {
 }
 
 /**
- * printLongestRepeatingSubsequence - Find and return one of the longest repeating subsequences
+ * printLongestRepeatingSubsequenceNaive - Find and return one of the longest repeating subsequences
  * @str: The input string
  * 
  * This function not only finds the length of the longest repeating subsequence but also
@@ -76,7 +90,7 @@ int longestRepeatingSubsequence(const std::string& str) {
  * 
  * Returns: One of the longest repeating subsequences as a string
  */
-std::string printLongestRepeatingSubsequence(const std::string& str) {
+std::string printLongestRepeatingSubsequenceNaive(const std::string& str) {
     int n = str.length();
     // Create and fill the DP table (same as in the previous function)
     std::vector<std::vector<int>> dp(n + 1, std::vector<int>(n + 1, 0));
@@ -117,7 +131,231 @@ std::string printLongestRepeatingSubsequence(const std::string& str) {
     return result;
 }
 
-int main() {
+/**
+ * longestRepeatingSubsequence - Length of the longest repeating subsequence in O(n) memory
+ * @str: The input string
+ * 
+ * Same recurrence as longestRepeatingSubsequenceNaive, but only the previous
+ * and the current row of the DP table are kept.
+ * 
+ * Returns: The length of the longest repeating subsequence
+ */
+int longestRepeatingSubsequence(const std::string& str) {
+    int n = str.length();
+    std::vector<int> prev(n + 1, 0), curr(n + 1, 0);
+    
+    for (int i = 1; i <= n; i++) {
+        for (int j = 1; j <= n; j++) {
+            if (str[i - 1] == str[j - 1] && i != j) {
+                curr[j] = prev[j - 1] + 1;
+            } else {
+                curr[j] = std::max(curr[j - 1], prev[j]);
+            }
+        }
+        std::swap(prev, curr);
+    }
+    
+    return prev[n];
+}
+
+/**
+ * lrsBoundaryRow - Last DP row of one block of the LRS table
+ * @str: The input string
+ * @i0, @i1: Rows str[i0..i1) of the first copy
+ * @j0, @j1: Columns str[j0..j1) of the second copy
+ * @reverse: Run the DP from the bottom-right corner of the block instead
+ * @row: Receives j1-j0+1 values
+ * 
+ * Forward, row[k] is the LRS length of the rows against str[j0..j0+k);
+ * reversed, it is the length against str[j0+k..j1). Indices stay absolute,
+ * so the "same position" rule (i != j) is applied correctly inside a block.
+ */
+void lrsBoundaryRow(const std::string& str, int i0, int i1, int j0, int j1, bool reverse, std::vector<int>& row) {
+    int w = j1 - j0;
+    std::vector<int> prev(w + 1, 0);
+    row.assign(w + 1, 0);
+    for (int step = 0; step < i1 - i0; step++) {
+        int i = reverse ? i1 - 1 - step : i0 + step;
+        for (int k = 1; k <= w; k++) {
+            int j = reverse ? j1 - k : j0 + k - 1;
+            if (str[i] == str[j] && i != j) {
+                row[k] = prev[k - 1] + 1;
+            } else {
+                row[k] = std::max(row[k - 1], prev[k]);
+            }
+        }
+        std::swap(prev, row);
+    }
+    std::swap(prev, row);
+    if (reverse) std::reverse(row.begin(), row.end());
+}
+
+/**
+ * hirschbergLrs - Append the LRS of rows [i0, i1) against columns [j0, j1) to @out
+ * 
+ * The optimal path through the block crosses the middle row at the column k
+ * that maximizes forward[k] + backward[k], so both halves can be solved
+ * independently. The boundary rows are released before recursing, so only
+ * O(n) values plus the O(log n) recursion stack are live at any time.
+ */
+void hirschbergLrs(const std::string& str, int i0, int i1, int j0, int j1, std::string& out) {
+    if (i0 >= i1 || j0 >= j1) return;
+    if (i1 - i0 == 1) {
+        for (int j = j0; j < j1; j++) {
+            if (str[i0] == str[j] && i0 != j) {
+                out += str[i0];
+                break;
+            }
+        }
+        return;
+    }
+    
+    int mid = (i0 + i1) / 2;
+    int split = 0;
+    {
+        // Scoped so the rows are freed before recursing; otherwise every level
+        // on the recursion stack would keep its own pair
+        std::vector<int> forward, backward;
+        lrsBoundaryRow(str, i0, mid, j0, j1, false, forward);
+        lrsBoundaryRow(str, mid, i1, j0, j1, true, backward);
+        for (int k = 1; k <= j1 - j0; k++) {
+            if (forward[k] + backward[k] > forward[split] + backward[split]) split = k;
+        }
+    }
+    
+    hirschbergLrs(str, i0, mid, j0, j0 + split, out);
+    hirschbergLrs(str, mid, i1, j0 + split, j1, out);
+}
+
+/**
+ * printLongestRepeatingSubsequence - One longest repeating subsequence in O(n) memory
+ * @str: The input string
+ * 
+ * Uses Hirschberg's divide and conquer instead of backtracking through an
+ * (n+1)×(n+1) table; the work is about twice that of filling the table once.
+ * 
+ * Returns: One of the longest repeating subsequences as a string
+ */
+std::string printLongestRepeatingSubsequence(const std::string& str) {
+    std::string result;
+    hirschbergLrs(str, 0, str.length(), 0, str.length(), result);
+    return result;
+}
+
+/**
+ * bitParallelLcs - LCS length of @a and @b, 64 DP cells per word (Hyyrö's algorithm)
+ * @excludeDiagonal: Forbid matching a[i] with b[i] (for the LRS, pass the same string twice)
+ * 
+ * Bit j of V is 1 where row i of the DP table does not increase at column j.
+ * For each character of @a, with M the positions in @b where it matches:
+ *     U = V & M;  V = (V + U) | (V - U)
+ * and the LCS length is the number of zero bits left in V. The addition and
+ * subtraction carry across words. Any match relation works, so the LRS rule
+ * is just one cleared bit in row i's match mask.
+ * 
+ * Returns: The length of the longest common subsequence
+ */
+int bitParallelLcs(const std::string& a, const std::string& b, bool excludeDiagonal = false) {
+    size_t m = b.length();
+    size_t words = (m + 63) / 64;
+    if (words == 0) return 0;
+    
+    // match[c * words + w]: bit j of word w is set where b[64w + j] == c
+    std::vector<uint64_t> match(256 * words, 0);
+    for (size_t j = 0; j < m; j++) {
+        match[(unsigned char)b[j] * words + j / 64] |= uint64_t(1) << (j % 64);
+    }
+    
+    std::vector<uint64_t> v(words, ~uint64_t(0));
+    for (size_t i = 0; i < a.length(); i++) {
+        const uint64_t* mask = &match[(unsigned char)a[i] * words];
+        unsigned char carry = 0, borrow = 0;
+        for (size_t w = 0; w < words; w++) {
+            uint64_t matches = mask[w];
+            if (excludeDiagonal && i / 64 == w) matches &= ~(uint64_t(1) << (i % 64));
+            uint64_t u = v[w] & matches;
+            
+            // sum = v + u + carry, diff = v - u - borrow, both carried across words
+            uint64_t sum = v[w] + u;
+            unsigned char carryOut = sum < u;
+            sum += carry;
+            carryOut |= sum < carry;
+            uint64_t diff = v[w] - u;
+            unsigned char borrowOut = v[w] < u;
+            borrowOut |= diff < borrow;
+            diff -= borrow;
+            
+            v[w] = sum | diff;
+            carry = carryOut;
+            borrow = borrowOut;
+        }
+    }
+    
+    // Count the zero bits among the m valid positions
+    int length = 0;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t valid = (w + 1 < words || m % 64 == 0) ? ~uint64_t(0) : (uint64_t(1) << (m % 64)) - 1;
+        length += __builtin_popcountll(~v[w] & valid);
+    }
+    return length;
+}
+
+/**
+ * longestRepeatingSubsequenceBitParallel - LRS length using the bit-parallel LCS kernel
+ */
+int longestRepeatingSubsequenceBitParallel(const std::string& str) {
+    return bitParallelLcs(str, str, true);
+}
+
+/**
+ * benchmarkRepeatingSubsequence - Time and memory of the different versions
+ * @maxN: Largest input length; the full-table versions stop at 8000
+ */
+void benchmarkRepeatingSubsequence(int maxN) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(5);
+    std::cout << "     n   table ms (MB)      two-row ms  bit-parallel ms  Hirschberg ms" << std::endl;
+    for (int n = 1000; n <= maxN; n *= 2) {
+        std::string str(n, 'A');
+        for (char& c : str) c = 'A' + rng() % 4;
+        
+        bool withTable = n <= 8000;
+        int viaTable = -1, viaRows = 0, viaBits = 0;
+        std::string viaTableString, viaHirschberg;
+        double tTable = withTable ? timeIt([&] {
+            viaTable = longestRepeatingSubsequenceNaive(str);
+            viaTableString = printLongestRepeatingSubsequenceNaive(str);
+        }) : -1;
+        double tRows = timeIt([&] { viaRows = longestRepeatingSubsequence(str); });
+        double tBits = timeIt([&] { viaBits = longestRepeatingSubsequenceBitParallel(str); });
+        double tHirschberg = timeIt([&] { viaHirschberg = printLongestRepeatingSubsequence(str); });
+        
+        bool ok = viaRows == viaBits && (int)viaHirschberg.size() == viaRows &&
+                  (!withTable || (viaTable == viaRows && (int)viaTableString.size() == viaRows));
+        double tableMb = 2.0 * (n + 1) * (n + 1) * sizeof(int) / 1e6;
+        
+        std::cout << std::setw(6) << n << std::fixed << std::setprecision(1);
+        if (withTable) {
+            std::cout << std::setw(11) << tTable * 1e3 << " (" << std::setw(5) << tableMb << ")";
+        } else {
+            std::cout << std::setw(11) << "-" << std::setw(8) << "";
+        }
+        std::cout << std::setw(14) << tRows * 1e3 << std::setw(17) << tBits * 1e3 << std::setw(15)
+                  << tHirschberg * 1e3 << std::defaultfloat << (ok ? "" : "  (MISMATCH)") << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkRepeatingSubsequence(argc > 2 ? std::stoi(argv[2]) : 32000);
+        return 0;
+    }
+    
     // Test string
     std::string str = "AABEBCDD";
     
@@ -134,5 +372,8 @@ int main() {
         std::cout << "One of the longest repeating subsequences: " << subsequence << std::endl;
     }
     
+    // Length from the bit-parallel kernel (64 DP cells per word)
+    std::cout << "Length (bit-parallel): " << longestRepeatingSubsequenceBitParallel(str) << std::endl;
+    
     return 0;
 }
\ No newline at end of file
@@ -8,19 +8,32 @@
  * - "A man, a plan, a canal: Panama" is a palindrome when ignoring spaces, punctuation, and case
  * - "race a car" is not a palindrome
  * 
+ * isPalindromeNaive builds a cleaned lowercase copy and compares it from both
+ * ends. isPalindrome skips non-alphanumeric characters in place with two
+ * pointers over a string_view instead, and compares whole 32-byte blocks
+ * when both ends are already clean (see palindromeString.h).
+ * 
  * Time Complexity: O(n) where n is the length of the string
- * Space Complexity: O(n) for storing the cleaned string
+ * Space Complexity: O(n) for the naive cleaned copy, O(1) for isPalindrome
  * 
  * Input: Strings like "A man, a plan, a canal: Panama" and "race a car"
  * Output: Whether each string is a palindrome or not
+ * 
+ * Benchmark: ./palindromeString --bench [MB]
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
 #include <cctype>    // For character classification and conversion functions
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <string_view>
+
+#include "palindromeString.h"
 
 /**
- * isPalindrome - Check if a string is a palindrome
+ * isPalindromeNaive - Check if a string is a palindrome
  * @str: The input string (passed by reference for efficiency)
  * 
  * This function performs the following steps:
@@ -31,7 +44,7 @@
  * 
  * Returns: true if the string is a palindrome, false otherwise
  */
-bool isPalindrome(const std::string& str) {
+bool isPalindromeNaive(const std::string& str) {
     std::string cleanStr;
     // Remove non-alphanumeric characters and convert to lowercase
     for (char c : str) {
@@ -55,7 +68,79 @@ bool isPalindrome(const std::string& str) {
     return true;
 }
 
-int main() {
+/**
+ * isPalindrome - Check if a string is a palindrome without copying it
+ * @str: The input string; any contiguous text converts to a string_view
+ * 
+ * Same rules as isPalindromeNaive (ASCII letters and digits only, case
+ * ignored), checked by isPalindromeFast from palindromeString.h.
+ * 
+ * Returns: true if the string is a palindrome, false otherwise
+ */
+bool isPalindrome(std::string_view str) {
+    return isPalindromeFast(str);
+}
+
+/**
+ * benchmarkPalindrome - Compare the checks on large palindromes
+ * @megabytes: Size of each input
+ * 
+ * Inputs: a clean mixed-case alphanumeric palindrome (vector path), the
+ * same with punctuation and spaces between words (mostly table path), and
+ * a clean text with one mismatch in the middle.
+ */
+void benchmarkPalindrome(size_t megabytes) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(19);
+    size_t half = (megabytes << 20) / 2;
+    std::string clean(half, 'a');
+    for (char& c : clean) c = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"[rng() % 62];
+    std::string cleanInput = clean + std::string(clean.rbegin(), clean.rend());
+    for (size_t k = half; k < cleanInput.size(); k++) {
+        if (std::isalpha((unsigned char)cleanInput[k]) && rng() % 2) cleanInput[k] ^= 0x20; // flip case
+    }
+    
+    std::string punctuated;
+    punctuated.reserve(half + half / 4);
+    for (size_t k = 0; k < half; k++) {
+        punctuated += clean[k];
+        if (rng() % 6 == 0) punctuated += " ,.:"[rng() % 4];
+    }
+    std::string punctuatedInput = punctuated + std::string(punctuated.rbegin(), punctuated.rend());
+    
+    std::string broken = cleanInput;
+    broken[half] = broken[half] == 'x' ? 'y' : 'x';
+    
+    std::cout << "Palindrome checks on " << megabytes << " MB inputs (GB/s):" << std::endl;
+    std::cout << std::left << std::setw(14) << "input" << std::setw(12) << "naive" << std::setw(12) << "table"
+              << std::setw(12) << "simd" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    
+    struct Case { const char* name; const std::string* text; bool expected; };
+    for (const Case& c : {Case{"clean", &cleanInput, true}, Case{"punctuated", &punctuatedInput, true},
+                          Case{"one mismatch", &broken, false}}) {
+        bool naive = false, table = false, simd = false;
+        double tNaive = timeIt([&] { naive = isPalindromeNaive(*c.text); });
+        double tTable = timeIt([&] { table = isPalindromeScalar(*c.text); });
+        double tSimd = timeIt([&] { simd = isPalindrome(*c.text); });
+        double gb = (double)c.text->size() / 1e9;
+        bool agree = naive == c.expected && table == c.expected && simd == c.expected;
+        std::cout << std::setw(14) << c.name << std::setw(12) << gb / tNaive << std::setw(12) << gb / tTable
+                  << std::setw(12) << gb / tSimd << (agree ? "" : "(MISMATCH)") << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkPalindrome(argc > 2 ? std::stoul(argv[2]) : 256);
+        return 0;
+    }
+    
     // Test strings
     std::string str1 = "A man, a plan, a canal: Panama";  // A palindrome
     std::string str2 = "race a car";  // Not a palindrome
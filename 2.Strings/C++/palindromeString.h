@@ -0,0 +1,154 @@
+/**
+ * Zero-Copy Palindrome Check
+ *
+ * Checks whether text reads the same both ways when only ASCII letters and
+ * digits are considered and case is ignored, without building a cleaned
+ * copy. Two pointers walk inward over a string_view; a 256-entry table
+ * maps every byte to its lowercase form, or to 0 for bytes to skip.
+ *
+ * With SSE2/AVX2 enabled, whenever the next 16/32 bytes at both ends are
+ * all alphanumeric the front block is compared with the byte-reversed back
+ * block in one step. Blocks containing punctuation, spaces or non-ASCII
+ * bytes fall back to the table for a while before the vector path is
+ * tried again.
+ *
+ * Time Complexity: O(n)
+ * Space Complexity: O(1)
+ */
+
+#ifndef PALINDROME_STRING_H
+#define PALINDROME_STRING_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "reverseString.h"
+
+namespace palindrome_detail {
+
+constexpr std::array<unsigned char, 256> makeFoldAlnumTable() {
+    std::array<unsigned char, 256> table{};
+    for (int c = 0; c < 256; c++) {
+        if (c >= '0' && c <= '9') table[c] = (unsigned char)c;
+        else if (c >= 'a' && c <= 'z') table[c] = (unsigned char)c;
+        else if (c >= 'A' && c <= 'Z') table[c] = (unsigned char)(c - 'A' + 'a');
+    }
+    return table;
+}
+
+// Number of scalar pairs compared before the vector path is retried
+constexpr int SCALAR_BURST = 32;
+
+/**
+ * scalarPairs - Compare up to maxPairs alphanumeric pairs from both ends
+ * @i: Front index, advanced past the pairs compared
+ * @j: One past the back index, moved back past the pairs compared
+ *
+ * Returns: false on a mismatch
+ */
+template <typename Table>
+inline bool scalarPairs(const unsigned char* s, size_t& i, size_t& j, int maxPairs, const Table& fold) {
+    for (int pair = 0; pair < maxPairs; pair++) {
+        while (i < j && !fold[s[i]]) i++;
+        while (i < j && !fold[s[j - 1]]) j--;
+        if (j - i < 2) {
+            i = j;
+            return true;
+        }
+        if (fold[s[i]] != fold[s[j - 1]]) return false;
+        i++;
+        j--;
+    }
+    return true;
+}
+
+#if defined(__AVX2__)
+// All-ones in the lanes holding an ASCII letter or digit; x is folded to lowercase
+inline __m256i alnumLanes(__m256i& x) {
+    __m256i lower = _mm256_or_si256(x, _mm256_set1_epi8(0x20)); // digits already have 0x20 set
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                      _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('0' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), x));
+    x = lower;
+    return _mm256_or_si256(letter, digit);
+}
+#endif
+
+#if defined(__SSE2__)
+inline __m128i alnumLanes(__m128i& x) {
+    __m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                   _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+    x = lower;
+    return _mm_or_si128(letter, digit);
+}
+#endif
+
+} // namespace palindrome_detail
+
+// Lowercase form of every ASCII letter or digit, 0 for every other byte
+constexpr std::array<unsigned char, 256> FOLD_ALNUM = palindrome_detail::makeFoldAlnumTable();
+
+/**
+ * isPalindromeScalar - Two-pointer check over the text, skipping via FOLD_ALNUM
+ * @text: The text; it is not copied
+ *
+ * Returns: true if the letters and digits of text form a palindrome
+ */
+inline bool isPalindromeScalar(std::string_view text) {
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(text.data());
+    size_t i = 0, j = text.size();
+    while (i < j) {
+        if (!palindrome_detail::scalarPairs(s, i, j, 1 << 30, FOLD_ALNUM)) return false;
+    }
+    return true;
+}
+
+/**
+ * isPalindromeFast - Two-pointer check that compares clean blocks 32 bytes at a time
+ * @text: The text; it is not copied
+ *
+ * Returns: true if the letters and digits of text form a palindrome
+ */
+inline bool isPalindromeFast(std::string_view text) {
+    using namespace palindrome_detail;
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(text.data());
+    size_t i = 0, j = text.size();
+
+    while (i < j) {
+#if defined(__AVX2__)
+        while (j - i >= 64) {
+            __m256i front = _mm256_loadu_si256((const __m256i*)(s + i));
+            __m256i back = _mm256_loadu_si256((const __m256i*)(s + j - 32));
+            __m256i clean = _mm256_and_si256(alnumLanes(front), alnumLanes(back));
+            if (_mm256_movemask_epi8(clean) != -1) break;
+            __m256i same = _mm256_cmpeq_epi8(front, reverse_detail::reverse32(back));
+            if (_mm256_movemask_epi8(same) != -1) return false;
+            i += 32;
+            j -= 32;
+        }
+#endif
+#if defined(__SSE2__)
+        while (j - i >= 32) {
+            __m128i front = _mm_loadu_si128((const __m128i*)(s + i));
+            __m128i back = _mm_loadu_si128((const __m128i*)(s + j - 16));
+            __m128i clean = _mm_and_si128(alnumLanes(front), alnumLanes(back));
+            if (_mm_movemask_epi8(clean) != 0xFFFF) break;
+            __m128i same = _mm_cmpeq_epi8(front, reverse_detail::reverse16(back));
+            if (_mm_movemask_epi8(same) != 0xFFFF) return false;
+            i += 16;
+            j -= 16;
+        }
+#endif
+        // Punctuation, spaces or the last few bytes: a burst of table lookups
+        if (!scalarPairs(s, i, j, SCALAR_BURST, FOLD_ALNUM)) return false;
+    }
+    return true;
+}
+
+#endif // PALINDROME_STRING_H
@@ -1,28 +1,45 @@
 /**
  * Remove Duplicates from String
  * 
- * This program demonstrates two different approaches to remove duplicate characters from a string:
+ * This program demonstrates different approaches to remove duplicate characters from a string:
  * 1. Using an unordered_set (hash set) to track seen characters
  * 2. Using a manual in-place approach without additional data structures
+ * 3. Using a 256-bit "seen" bitmap, compacting the string in place
+ * 4. Treating the string as UTF-8 and removing repeated code points, with the
+ *    bitmap for ASCII and a small open-addressing set for the rest
+ * 5. A streaming version of 4 that keeps its seen set (and any UTF-8
+ *    sequence cut off at the end of a chunk) from one chunk to the next
  * 
  * Time Complexity:
  * - Hash set approach: O(n) where n is the length of the string
  * - Manual approach: O(n²) due to the nested loops
+ * - Bitmap and code point approaches: O(n)
  * 
  * Space Complexity:
  * - Hash set approach: O(k) where k is the number of unique characters (at most 256 for ASCII)
  * - Manual approach: O(1) extra space (in-place modification)
+ * - Bitmap approach: 32 bytes
+ * - Code point approach: O(k) for the k distinct non-ASCII code points
  * 
  * Input: Strings like "programming" and "hello world"
  * Output: The strings with duplicate characters removed (e.g., "progamin" and "helo wrd")
+ * 
+ * Benchmark: ./removeDuplicates --bench [MB]
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
 #include <unordered_set>  // For hash set implementation
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <string_view>
+#include <vector>
 
 /**
- * removeDuplicates - Remove duplicate characters using a hash set
+ * removeDuplicatesUsingSet - Remove duplicate characters using a hash set
  * @str: The input string (passed by reference for efficiency)
  * 
  * This function uses an unordered_set (hash set) to track characters that have been seen.
@@ -36,7 +53,7 @@
  * 
  * Returns: A new string with duplicate characters removed
  */
-std::string removeDuplicates(const std::string& str) {
+std::string removeDuplicatesUsingSet(const std::string& str) {
     std::string result;  // Will hold the string with duplicates removed
     std::unordered_set<char> seen;  // Tracks characters we've already seen
     
@@ -91,7 +108,344 @@ std::string removeDuplicatesManual(std::string str) {
     return str;
 }
 
-int main() {
+/**
+ * removeDuplicatesInPlace - Remove duplicate bytes using a 256-bit seen bitmap
+ * @str: The string to compact in place
+ * 
+ * At most 256 bytes can be new, so after the first few the "already seen"
+ * branch is always predicted and the loop is one bit test per byte. Once
+ * all 256 byte values have been seen the rest of the string is dropped.
+ */
+void removeDuplicatesInPlace(std::string& str) {
+    uint64_t seen[4] = {0, 0, 0, 0};
+    char* s = &str[0];
+    size_t n = str.size(), write = 0, distinct = 0;
+    
+    for (size_t i = 0; i < n && distinct < 256; i++) {
+        unsigned char c = (unsigned char)s[i];
+        uint64_t bit = 1ULL << (c & 63);
+        if (seen[c >> 6] & bit) continue;
+        seen[c >> 6] |= bit;
+        s[write++] = (char)c;
+        distinct++;
+    }
+    str.resize(write);
+}
+
+/**
+ * removeDuplicates - Remove duplicate characters using a seen bitmap
+ * @str: The input string
+ * 
+ * Returns: A new string with duplicate characters removed
+ */
+std::string removeDuplicates(const std::string& str) {
+    uint64_t seen[4] = {0, 0, 0, 0};
+    std::string result;
+    for (unsigned char c : str) {
+        uint64_t bit = 1ULL << (c & 63);
+        if (seen[c >> 6] & bit) continue;
+        seen[c >> 6] |= bit;
+        result += (char)c;
+        if (result.size() == 256) break; // Every byte value seen
+    }
+    return result;
+}
+
+// Malformed UTF-8 byte b is treated as the pseudo code point MALFORMED_BASE + b,
+// so each malformed byte value is kept once
+constexpr uint32_t MALFORMED_BASE = 0x110000;
+// decodeCodePoint result for a valid sequence that runs past the end of the input
+constexpr uint32_t TRUNCATED = UINT32_MAX - 1;
+
+/**
+ * decodeCodePoint - Decode the UTF-8 sequence starting at s[i]
+ * @len: Receives the number of bytes consumed
+ * 
+ * Overlong forms, surrogates and values above U+10FFFF are malformed.
+ * 
+ * Returns: The code point, MALFORMED_BASE + byte for a malformed byte (len 1),
+ *          or TRUNCATED if the input ends inside an otherwise valid sequence
+ */
+uint32_t decodeCodePoint(const unsigned char* s, size_t n, size_t i, size_t& len) {
+    unsigned char lead = s[i];
+    len = 1;
+    if (lead < 0x80) return lead;
+    
+    size_t need;
+    unsigned char lo = 0x80, hi = 0xBF; // Allowed range of the second byte
+    if (lead >= 0xC2 && lead <= 0xDF) need = 2;
+    else if (lead >= 0xE0 && lead <= 0xEF) {
+        need = 3;
+        if (lead == 0xE0) lo = 0xA0;
+        if (lead == 0xED) hi = 0x9F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        need = 4;
+        if (lead == 0xF0) lo = 0x90;
+        if (lead == 0xF4) hi = 0x8F;
+    } else {
+        return MALFORMED_BASE + lead;
+    }
+    
+    uint32_t cp = lead & (0x7F >> need);
+    for (size_t k = 1; k < need; k++) {
+        if (i + k >= n) return TRUNCATED;
+        unsigned char c = s[i + k];
+        if (k == 1 ? (c < lo || c > hi) : (c & 0xC0) != 0x80) return MALFORMED_BASE + lead;
+        cp = (cp << 6) | (c & 0x3F);
+    }
+    len = need;
+    return cp;
+}
+
+/**
+ * CodePointSet - Set of code points: a bitmap below 256, open addressing above
+ */
+class CodePointSet {
+public:
+    CodePointSet() : slots_(64, EMPTY) {}
+    
+    size_t size() const { return size_; }
+    
+    /**
+     * insert - Add a code point
+     * 
+     * Returns: true if it was not in the set yet
+     */
+    bool insert(uint32_t cp) {
+        if (cp < 256) {
+            uint64_t bit = 1ULL << (cp & 63);
+            if (low_[cp >> 6] & bit) return false;
+            low_[cp >> 6] |= bit;
+            size_++;
+            return true;
+        }
+        
+        size_t slot = find(cp);
+        if (slots_[slot] == cp) return false;
+        if (2 * (high_ + 1) > slots_.size()) {
+            grow();
+            slot = find(cp);
+        }
+        slots_[slot] = cp;
+        high_++;
+        size_++;
+        return true;
+    }
+    
+    void clear() {
+        std::fill(std::begin(low_), std::end(low_), 0);
+        slots_.assign(64, EMPTY);
+        high_ = size_ = 0;
+    }
+    
+private:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+    
+    size_t find(uint32_t cp) const {
+        size_t mask = slots_.size() - 1;
+        size_t slot = (size_t)((cp * 0x9E3779B1u) >> 8) & mask;
+        while (slots_[slot] != EMPTY && slots_[slot] != cp) slot = (slot + 1) & mask;
+        return slot;
+    }
+    
+    void grow() {
+        std::vector<uint32_t> old(slots_.size() * 2, EMPTY);
+        old.swap(slots_);
+        for (uint32_t cp : old) {
+            if (cp != EMPTY) slots_[find(cp)] = cp;
+        }
+    }
+    
+    uint64_t low_[4] = {0, 0, 0, 0};
+    std::vector<uint32_t> slots_; // Power-of-two size, at most half full
+    size_t high_ = 0;             // Code points stored in slots_
+    size_t size_ = 0;
+};
+
+/**
+ * dedupeCodePoints - Copy every first occurrence of a code point from src to dst
+ * @src: Input bytes
+ * @n: Number of input bytes
+ * @dst: Output; may equal src, since output never overtakes input
+ * @final: If false, stop before a sequence cut off by the end of the input
+ * @seen: Code points seen so far; updated
+ * @written: Receives the number of bytes written to dst
+ * 
+ * Returns: The number of input bytes consumed
+ */
+size_t dedupeCodePoints(const char* src, size_t n, char* dst, bool final, CodePointSet& seen, size_t& written) {
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(src);
+    size_t i = 0, write = 0;
+    
+    while (i < n) {
+        // ASCII fast path
+        if (s[i] < 0x80) {
+            if (seen.insert(s[i])) dst[write++] = src[i];
+            i++;
+            continue;
+        }
+        
+        size_t len;
+        uint32_t cp = decodeCodePoint(s, n, i, len);
+        if (cp == TRUNCATED) {
+            if (!final) break;
+            cp = MALFORMED_BASE + s[i];
+        }
+        if (seen.insert(cp)) {
+            for (size_t k = 0; k < len; k++) dst[write + k] = src[i + k];
+            write += len;
+        }
+        i += len;
+    }
+    written = write;
+    return i;
+}
+
+/**
+ * removeDuplicateCodePoints - Remove repeated UTF-8 code points, in place
+ * @str: UTF-8 text; each malformed byte counts as a character of its own
+ */
+void removeDuplicateCodePoints(std::string& str) {
+    CodePointSet seen;
+    size_t written;
+    dedupeCodePoints(str.data(), str.size(), &str[0], true, seen, written);
+    str.resize(written);
+}
+
+/**
+ * DuplicateFilter - removeDuplicateCodePoints over text that arrives in chunks
+ * 
+ * A character is dropped if it appeared in any earlier chunk, and a UTF-8
+ * sequence split across two chunks is held back until it is complete.
+ * 
+ *     DuplicateFilter filter;
+ *     std::string out;
+ *     while (readChunk(buf)) filter.feed(buf, out);
+ *     filter.finish(out);
+ */
+class DuplicateFilter {
+public:
+    /**
+     * feed - Append the new characters of chunk to out
+     */
+    void feed(std::string_view chunk, std::string& out) {
+        // Complete a sequence left over from the previous chunk, one byte at a time
+        while (pendingLen_ > 0 && !chunk.empty()) {
+            pending_[pendingLen_++] = chunk[0];
+            chunk.remove_prefix(1);
+            emit(pending_, pendingLen_, false, out);
+        }
+        if (chunk.empty()) return;
+        
+        size_t consumed = emit(chunk.data(), chunk.size(), false, out);
+        for (size_t k = consumed; k < chunk.size(); k++) pending_[pendingLen_++] = chunk[k];
+    }
+    
+    /**
+     * finish - Flush a sequence cut off by the end of the input
+     */
+    void finish(std::string& out) {
+        emit(pending_, pendingLen_, true, out);
+    }
+    
+    void reset() {
+        seen_.clear();
+        pendingLen_ = 0;
+    }
+    
+    size_t distinct() const { return seen_.size(); }
+    
+private:
+    // Dedupe src onto the end of out; bytes src leaves unconsumed are not kept
+    size_t emit(const char* src, size_t n, bool final, std::string& out) {
+        size_t start = out.size(), written;
+        out.resize(start + n);
+        size_t consumed = dedupeCodePoints(src, n, &out[start], final, seen_, written);
+        out.resize(start + written);
+        
+        // The pending buffer keeps whatever it could not consume
+        if (src == pending_) {
+            pendingLen_ -= consumed;
+            std::copy(pending_ + consumed, pending_ + consumed + pendingLen_, pending_);
+        }
+        return consumed;
+    }
+    
+    CodePointSet seen_;
+    char pending_[4];
+    size_t pendingLen_ = 0;
+};
+
+/**
+ * benchmarkRemoveDuplicates - Compare the approaches on ASCII and UTF-8 text
+ * @megabytes: Size of each input
+ */
+void benchmarkRemoveDuplicates(size_t megabytes) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(21);
+    std::string ascii(megabytes << 20, ' ');
+    for (char& c : ascii) c = (char)(32 + rng() % 95);
+    
+    // Words of 3-8 characters, mostly ASCII, some Latin-1/Greek and some CJK,
+    // drawn from a few thousand code points
+    std::string text;
+    text.reserve((megabytes << 20) + 32);
+    while (text.size() < (megabytes << 20)) {
+        uint32_t script = rng() % 16;
+        for (uint32_t k = 3 + rng() % 6; k > 0; k--) {
+            uint32_t cp = script < 10 ? 'a' + rng() % 26 : script < 13 ? 0xC0 + rng() % 0x300 : 0x4E00 + rng() % 3000;
+            if (cp < 0x80) {
+                text += (char)cp;
+            } else if (cp < 0x800) {
+                text += (char)(0xC0 | (cp >> 6));
+                text += (char)(0x80 | (cp & 0x3F));
+            } else {
+                text += (char)(0xE0 | (cp >> 12));
+                text += (char)(0x80 | ((cp >> 6) & 0x3F));
+                text += (char)(0x80 | (cp & 0x3F));
+            }
+        }
+        text += ' ';
+    }
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Byte dedupe of " << megabytes << " MB printable ASCII (GB/s):" << std::endl;
+    std::string viaSet, viaManual, viaBitmap, inPlaceBytes = ascii;
+    double gb = (double)ascii.size() / 1e9;
+    double tSet = timeIt([&] { viaSet = removeDuplicatesUsingSet(ascii); });
+    double tManual = timeIt([&] { viaManual = removeDuplicatesManual(ascii); });
+    double tBitmap = timeIt([&] { viaBitmap = removeDuplicates(ascii); });
+    double tInPlaceBytes = timeIt([&] { removeDuplicatesInPlace(inPlaceBytes); });
+    bool agree = viaSet == viaManual && viaManual == viaBitmap && viaBitmap == inPlaceBytes;
+    std::cout << "  unordered_set " << gb / tSet << ", manual " << gb / tManual << ", bitmap " << gb / tBitmap
+              << ", bitmap in place " << gb / tInPlaceBytes << (agree ? "" : "  (MISMATCH)") << std::endl;
+    
+    std::cout << "Code point dedupe of " << megabytes << " MB UTF-8 text (GB/s):" << std::endl;
+    std::string inPlace = text, streamed;
+    gb = (double)text.size() / 1e9;
+    double tInPlace = timeIt([&] { removeDuplicateCodePoints(inPlace); });
+    double tStream = timeIt([&] {
+        DuplicateFilter filter;
+        for (size_t pos = 0; pos < text.size(); pos += 64 * 1024 + 1) {
+            filter.feed(std::string_view(text).substr(pos, 64 * 1024 + 1), streamed);
+        }
+        filter.finish(streamed);
+    });
+    std::cout << "  in place " << gb / tInPlace << ", DuplicateFilter (64 KB chunks) " << gb / tStream << " ("
+              << inPlace.size() << " bytes kept)" << (inPlace == streamed ? "" : "  (MISMATCH)") << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkRemoveDuplicates(argc > 2 ? std::stoul(argv[2]) : 256);
+        return 0;
+    }
+    
     // Test strings
     std::string str1 = "programming";
     std::string str2 = "hello world";
@@ -104,5 +458,22 @@ int main() {
     std::cout << "\nOriginal string 2: " << str2 << std::endl;
     std::cout << "After removing duplicates (manual): " << removeDuplicatesManual(str2) << std::endl;
     
+    // Test the bitmap approach
+    std::cout << "\nOriginal string 1: " << str1 << std::endl;
+    std::cout << "After removing duplicates (bitmap): " << removeDuplicates(str1) << std::endl;
+    
+    // UTF-8 text, whole and in chunks that split multibyte characters
+    std::string text = "ma\u00f1ana se\u00f1or \u00bfqu\u00e9 tal?";
+    std::string codePoints = text;
+    removeDuplicateCodePoints(codePoints);
+    std::cout << "\nOriginal UTF-8 string: " << text << std::endl;
+    std::cout << "After removing duplicate characters: " << codePoints << std::endl;
+    
+    DuplicateFilter filter;
+    std::string streamed;
+    for (size_t pos = 0; pos < text.size(); pos += 3) filter.feed(text.substr(pos, 3), streamed);
+    filter.finish(streamed);
+    std::cout << "Streamed in 3-byte chunks: " << streamed << std::endl;
+    
     return 0;
 }
\ No newline at end of file
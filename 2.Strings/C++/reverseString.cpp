@@ -1,23 +1,36 @@
 /**
  * Reverse String
  * 
- * This program demonstrates two different approaches to reverse a string in-place:
+ * This program demonstrates different approaches to reverse a string in-place:
  * 1. Using the standard library function std::reverse
  * 2. Using a manual two-pointer approach
+ * 3. Using SIMD byte shuffles on 32-byte blocks taken from both ends (reverseBytes)
+ * 4. Reversing UTF-8 text by grapheme cluster, so multibyte characters,
+ *    accents and emoji sequences stay intact (reverseUtf8)
  * 
- * Time Complexity: O(n) for both approaches, where n is the length of the string
- * Space Complexity: O(1) for both approaches (in-place reversal)
+ * The last two live in reverseString.h.
+ * 
+ * Time Complexity: O(n) for all approaches, where n is the length of the string
+ * Space Complexity: O(1) for all approaches (in-place reversal)
  * 
  * Input: Strings like "Hello, World!" and "Programming"
  * Output: The reversed strings (e.g., "!dlroW ,olleH" and "gnimmargorP")
+ * 
+ * Benchmark: ./reverseString --bench [max MB]
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
 #include <algorithm> // For std::reverse and std::swap functions
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+#include "reverseString.h"
 
 /**
- * reverseString - Reverse a string using the standard library function
+ * reverseStringStd - Reverse a string using the standard library function
  * @str: The input string (passed by reference to modify in-place)
  * 
  * This function uses std::reverse from the <algorithm> header to reverse
@@ -27,10 +40,21 @@
  * The function works by swapping characters from both ends moving inward
  * until the pointers meet in the middle.
  */
-void reverseString(std::string& str) {
+void reverseStringStd(std::string& str) {
     std::reverse(str.begin(), str.end());
 }
 
+/**
+ * reverseString - Reverse a string in-place with SIMD block swaps
+ * @str: The input string (passed by reference to modify in-place)
+ * 
+ * Bytes are reversed, so multibyte UTF-8 characters come out scrambled;
+ * use reverseUtf8 for text.
+ */
+void reverseString(std::string& str) {
+    reverseBytes(&str[0], str.size());
+}
+
 /**
  * reverseStringManual - Reverse a string manually using two pointers
  * @str: The input string (passed by reference to modify in-place)
@@ -58,7 +82,60 @@ void reverseStringManual(std::string& str) {
     }
 }
 
-int main() {
+/**
+ * benchmarkReverse - Reverse throughput for buffers from 1 KB up to maxMegabytes
+ * @maxMegabytes: Largest buffer size; each size is reversed repeatedly until
+ *                about 256 MB have been processed
+ */
+void benchmarkReverse(size_t maxMegabytes) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    // Mostly ASCII text with Latin accents, CJK and emoji mixed in for reverseUtf8
+    const std::vector<std::string> pieces = {"the ", "quick ", "brown ", "fox ", "caf\u00e9 ", "e\u0301 ",
+                                             "\u65e5\u672c ", "\U0001F44D\U0001F3FD ", "\U0001F1EB\U0001F1F7 ", "\r\n"};
+    std::mt19937 rng(18);
+    
+    std::cout << "Reverse throughput (GB/s):" << std::endl;
+    std::cout << std::left << std::setw(10) << "size" << std::setw(14) << "std::reverse" << std::setw(14)
+              << "manual" << std::setw(14) << "reverseBytes" << std::setw(14) << "reverseUtf8" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    
+    for (size_t size = 1024; size <= (maxMegabytes << 20); size *= 32) {
+        std::string text;
+        text.reserve(size + 16);
+        while (text.size() < size) text += pieces[rng() % pieces.size()];
+        const std::string original = text;
+        size_t reps = std::max<size_t>(2, (256u << 20) / text.size()) & ~size_t(1); // even, so text ends as it began
+        double gb = (double)text.size() * reps / 1e9;
+        
+        double tStd = timeIt([&] { for (size_t r = 0; r < reps; r++) reverseStringStd(text); });
+        double tManual = timeIt([&] { for (size_t r = 0; r < reps; r++) reverseStringManual(text); });
+        double tSimd = timeIt([&] { for (size_t r = 0; r < reps; r++) reverseString(text); });
+        double tUtf8 = timeIt([&] { for (size_t r = 0; r < reps; r++) reverseUtf8(text); });
+        
+        // Single reversals must agree with std::reverse
+        std::string expected = original, viaSimd = original;
+        reverseStringStd(expected);
+        reverseString(viaSimd);
+        bool agree = text == original && viaSimd == expected;
+        
+        std::string label = size >= (1u << 20) ? std::to_string(size >> 20) + " MB" : std::to_string(size >> 10) + " KB";
+        std::cout << std::setw(10) << label << std::setw(14) << gb / tStd << std::setw(14) << gb / tManual
+                  << std::setw(14) << gb / tSimd << std::setw(14) << gb / tUtf8 << (agree ? "" : "(MISMATCH)")
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkReverse(argc > 2 ? std::stoul(argv[2]) : 1024);
+        return 0;
+    }
+    
     // Test strings
     std::string str = "Hello, World!";
     std::string str2 = "Programming";
@@ -67,11 +144,21 @@ int main() {
     std::cout << "Original strings:\n" << str << "\n" << str2 << std::endl;
     
     // Reverse strings using both methods
-    reverseString(str);  // Using std::reverse
+    reverseStringStd(str);  // Using std::reverse
     reverseStringManual(str2);  // Using manual implementation
     
     // Display reversed strings
     std::cout << "After reversal:\n" << str << "\n" << str2 << std::endl;
     
+    // Multibyte text: bytes versus grapheme clusters
+    std::string text = "na\u00efve caf\u00e9 \U0001F44D\U0001F3FD \U0001F1EF\U0001F1F5";
+    std::string bytes = text;
+    reverseString(bytes);
+    std::string clusters = text;
+    reverseUtf8(clusters);
+    std::cout << "\nUTF-8 string: " << text << std::endl;
+    std::cout << "Reversed by grapheme: " << clusters << std::endl;
+    std::cout << "Same as byte reversal? " << (bytes == clusters ? "Yes" : "No") << std::endl;
+    
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,247 @@
+/**
+ * In-Place Byte and UTF-8 Reversal
+ *
+ * reverseBytes reverses a buffer in place. With AVX2 enabled (-mavx2 /
+ * -march=native) it loads a 32-byte block from each end, reverses both in
+ * registers (pshufb within each 128-bit lane, then a lane swap) and stores
+ * each at the other end; SSE2 does the same with 16-byte blocks, and the
+ * last few bytes in the middle are swapped one at a time.
+ *
+ * reverseUtf8 reverses text by user-perceived characters instead of bytes,
+ * so multibyte sequences, combining accents, emoji with skin-tone
+ * modifiers or ZWJ joiners, flags and CR LF pairs come out intact. It
+ * reverses the bytes of every multi-unit cluster in place and then
+ * reverses the whole buffer, which restores each cluster's own order.
+ * Cluster boundaries follow the main rules of Unicode extended grapheme
+ * clusters (UAX #29) using small tables of the common combining and
+ * pictographic ranges rather than the full Unicode property database; a ZWJ
+ * only joins two pictographs, as in the emoji ZWJ sequences. Malformed bytes are
+ * treated as one-byte clusters.
+ *
+ * Time Complexity: O(n) for both
+ * Space Complexity: O(1)
+ */
+
+#ifndef REVERSE_STRING_H
+#define REVERSE_STRING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace reverse_detail {
+
+#if defined(__AVX2__)
+inline __m256i reverse32(__m256i x) {
+    const __m256i laneReverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(x, laneReverse), 0x4E);
+}
+#endif
+
+#if defined(__SSE2__)
+inline __m128i reverse16(__m128i x) {
+#if defined(__SSSE3__)
+    return _mm_shuffle_epi8(x, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // Swap the bytes of each 16-bit word, then reverse the eight words
+    x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+    x = _mm_shufflelo_epi16(x, 0x1B);
+    x = _mm_shufflehi_epi16(x, 0x1B);
+    return _mm_shuffle_epi32(x, 0x4E);
+#endif
+}
+#endif
+
+// Code points that attach to the preceding character (Grapheme_Extend and
+// Spacing marks of the most common scripts, variation selectors, emoji
+// modifiers and tag characters)
+constexpr uint32_t EXTEND_RANGES[][2] = {
+    {0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x05BF, 0x05C7}, {0x0610, 0x061A},
+    {0x064B, 0x065F}, {0x0670, 0x0670}, {0x06D6, 0x06DC}, {0x06DF, 0x06E4}, {0x06E7, 0x06ED},
+    {0x0900, 0x0903}, {0x093A, 0x094F}, {0x0951, 0x0957}, {0x0962, 0x0963}, {0x0981, 0x0983},
+    {0x09BC, 0x09D7}, {0x0E31, 0x0E31}, {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x1160, 0x11FF},
+    {0x1AB0, 0x1AFF}, {0x1DC0, 0x1DFF}, {0x200C, 0x200C}, {0x20D0, 0x20FF}, {0x302A, 0x302F},
+    {0x3099, 0x309A}, {0xFE00, 0xFE0F}, {0xFE20, 0xFE2F}, {0x1F3FB, 0x1F3FF}, {0xE0020, 0xE007F},
+    {0xE0100, 0xE01EF},
+};
+
+// Extended_Pictographic code points, the only ones a ZWJ joins (the emoji
+// blocks plus the older symbols used in sequences such as U+2764 U+200D U+1F525)
+constexpr uint32_t PICTOGRAPHIC_RANGES[][2] = {
+    {0x00A9, 0x00A9}, {0x00AE, 0x00AE}, {0x203C, 0x203C}, {0x2049, 0x2049}, {0x2122, 0x2122},
+    {0x2139, 0x2139}, {0x2194, 0x21AA}, {0x231A, 0x23FF}, {0x24C2, 0x24C2}, {0x25AA, 0x25FE},
+    {0x2600, 0x27BF}, {0x2934, 0x2935}, {0x2B05, 0x2B55}, {0x3030, 0x3030}, {0x303D, 0x303D},
+    {0x3297, 0x3297}, {0x3299, 0x3299}, {0x1F000, 0x1FAFF},
+};
+
+constexpr uint32_t ZERO_WIDTH_JOINER = 0x200D;
+constexpr uint32_t INVALID_CODE_POINT = 0xFFFFFFFF;
+
+template <size_t N>
+inline bool inRanges(const uint32_t (&ranges)[N][2], uint32_t cp) {
+    if (cp < ranges[0][0]) return false;
+    // Binary search for the last range starting at or before cp
+    size_t lo = 0, hi = N;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (ranges[mid][0] <= cp) lo = mid;
+        else hi = mid;
+    }
+    return cp <= ranges[lo][1];
+}
+
+inline bool isExtend(uint32_t cp) { return inRanges(EXTEND_RANGES, cp); }
+
+inline bool isPictographic(uint32_t cp) { return inRanges(PICTOGRAPHIC_RANGES, cp); }
+
+inline bool isRegionalIndicator(uint32_t cp) { return cp >= 0x1F1E6 && cp <= 0x1F1FF; }
+
+/**
+ * decodeUtf8 - Decode the code point starting at s[i]
+ * @len: Receives the number of bytes consumed (1 for a malformed sequence)
+ *
+ * Returns: The code point, or INVALID_CODE_POINT for a malformed sequence
+ */
+inline uint32_t decodeUtf8(const unsigned char* s, size_t n, size_t i, size_t& len) {
+    unsigned char lead = s[i];
+    len = 1;
+    if (lead < 0x80) return lead;
+
+    size_t extra;
+    uint32_t cp;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        extra = 1;
+        cp = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        extra = 2;
+        cp = lead & 0x0F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        extra = 3;
+        cp = lead & 0x07;
+    } else {
+        return INVALID_CODE_POINT;
+    }
+    if (n - i <= extra) return INVALID_CODE_POINT;
+    for (size_t k = 1; k <= extra; k++) {
+        if ((s[i + k] & 0xC0) != 0x80) return INVALID_CODE_POINT;
+        cp = (cp << 6) | (s[i + k] & 0x3F);
+    }
+    len = extra + 1;
+    return cp;
+}
+
+/**
+ * clusterEnd - Index one past the grapheme cluster starting at s[i]
+ */
+inline size_t clusterEnd(const unsigned char* s, size_t n, size_t i) {
+    size_t len;
+    uint32_t cp = decodeUtf8(s, n, i, len);
+    size_t j = i + len;
+    if (cp == INVALID_CODE_POINT) return j;
+    if (cp == '\r') return j < n && s[j] == '\n' ? j + 1 : j;
+    if (cp < 0x20 || cp == 0x7F) return j;
+
+    // A flag is a pair of regional indicators
+    if (isRegionalIndicator(cp) && j < n) {
+        uint32_t next = decodeUtf8(s, n, j, len);
+        if (isRegionalIndicator(next)) j += len;
+    }
+
+    bool pictographic = isPictographic(cp);
+    while (j < n) {
+        uint32_t next = decodeUtf8(s, n, j, len);
+        if (next == ZERO_WIDTH_JOINER) {
+            j += len;
+            // ZWJ glues a following pictograph onto a pictograph cluster; after
+            // anything else it is only an extending character
+            if (pictographic && j < n) {
+                uint32_t joined = decodeUtf8(s, n, j, len);
+                if (isPictographic(joined)) j += len;
+            }
+        } else if (isExtend(next)) {
+            j += len;
+        } else {
+            break;
+        }
+    }
+    return j;
+}
+
+// True when none of the 8 bytes at p is non-ASCII or '\r'
+inline bool plainAscii8(const unsigned char* p) {
+    uint64_t word;
+    std::memcpy(&word, p, 8);
+    constexpr uint64_t ONES = 0x0101010101010101ULL, HIGHS = 0x8080808080808080ULL;
+    uint64_t cr = word ^ (ONES * '\r');
+    return ((word | ((cr - ONES) & ~cr)) & HIGHS) == 0;
+}
+
+} // namespace reverse_detail
+
+/**
+ * reverseBytes - Reverse a buffer in place, 32 bytes per step from each end
+ * @data: The buffer
+ * @n: Its length in bytes
+ */
+inline void reverseBytes(char* data, size_t n) {
+    size_t i = 0, j = n;
+
+#if defined(__AVX2__)
+    for (; j - i >= 64; i += 32, j -= 32) {
+        __m256i front = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i back = _mm256_loadu_si256((const __m256i*)(data + j - 32));
+        _mm256_storeu_si256((__m256i*)(data + i), reverse_detail::reverse32(back));
+        _mm256_storeu_si256((__m256i*)(data + j - 32), reverse_detail::reverse32(front));
+    }
+#endif
+#if defined(__SSE2__)
+    for (; j - i >= 32; i += 16, j -= 16) {
+        __m128i front = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i back = _mm_loadu_si128((const __m128i*)(data + j - 16));
+        _mm_storeu_si128((__m128i*)(data + i), reverse_detail::reverse16(back));
+        _mm_storeu_si128((__m128i*)(data + j - 16), reverse_detail::reverse16(front));
+    }
+#endif
+
+    // Fewer than 32 bytes (or the whole buffer without SSE2) left in the middle
+    std::reverse(data + i, data + j);
+}
+
+/**
+ * reverseUtf8 - Reverse UTF-8 text by grapheme cluster, in place
+ * @str: The text; malformed bytes are reversed as single bytes
+ */
+inline void reverseUtf8(std::string& str) {
+    using namespace reverse_detail;
+    unsigned char* s = reinterpret_cast<unsigned char*>(&str[0]);
+    size_t n = str.size();
+
+    size_t i = 0;
+    while (i < n) {
+        // Runs of plain ASCII are one-byte clusters; the last byte of a run
+        // is rechecked because a combining mark may follow it
+        while (i + 8 <= n && plainAscii8(s + i)) i += 7;
+        if (s[i] < 0x80 && s[i] != '\r' && (i + 1 == n || s[i + 1] < 0x80)) {
+            i++;
+            continue;
+        }
+
+        size_t end = clusterEnd(s, n, i);
+        if (end - i > 1) std::reverse(s + i, s + end);
+        i = end;
+    }
+    reverseBytes(&str[0], n);
+}
+
+#endif // REVERSE_STRING_H
@@ -0,0 +1,245 @@
+/**
+ * Rope (Editable Text Buffer)
+ *
+ * This program edits a document stored as a Rope (see rope.h): a balanced
+ * tree of chunks of at most ROPE_LEAF_MAX bytes, where inserting or erasing
+ * text only touches O(log n) tree nodes and one or two chunks instead of
+ * shifting the rest of the document like std::string does.
+ *
+ * The string algorithms from this directory run on a Rope chunk by chunk,
+ * without flattening it into one buffer first:
+ * - myStrStr feeds the chunks through a MatchStream (substringSearch.h)
+ * - isPalindrome walks one chunk iterator forward and one backward
+ * - reverseString mirrors the tree and reverses each chunk with reverseBytes
+ * - countVowelsAndConsonants feeds the chunks to a CharClassCounter (charClass.h)
+ *
+ * Time Complexity:
+ * - insert / erase / at: O(log n + ROPE_LEAF_MAX) where n is the document length
+ * - Whole-document algorithms: O(n), the same as on a std::string
+ *
+ * Space Complexity: O(n)
+ *
+ * Input: The sentence "A man, a plan, a canal: Panama", edited in place
+ * Output: The text after each edit and the results of the algorithms on it
+ *
+ * Benchmark: ./rope --bench [MB] [edits]
+ */
+
+#include <iostream>  // For input/output operations
+#include <string>    // For string operations
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "charClass.h"
+#include "palindromeString.h"
+#include "rope.h"
+#include "substringSearch.h"
+
+/**
+ * myStrStr - Find the first occurrence of a substring in a rope
+ * @haystack: The rope to search in
+ * @needle: The substring to search for
+ *
+ * Matches that straddle two chunks are found by the MatchStream carry, and
+ * the search stops after the chunk that contains the first match.
+ *
+ * Returns: The position of the first occurrence, or string::npos if not found
+ */
+size_t myStrStr(const Rope& haystack, const std::string& needle) {
+    if (needle.empty()) return 0;
+    
+    SubstringSearcher searcher(needle);
+    MatchStream stream(searcher);
+    size_t first = std::string::npos;
+    for (std::string_view chunk : haystack.chunks()) {
+        stream.feed(chunk, [&](size_t offset) { first = std::min(first, offset); });
+        if (first != std::string::npos) break;
+    }
+    return first;
+}
+
+/**
+ * isPalindrome - Check if a rope is a palindrome, ignoring non-alphanumerics and case
+ * @text: The rope to check
+ *
+ * One cursor walks the chunks from the front and one from the back, both
+ * skipping bytes that FOLD_ALNUM maps to 0, until they meet.
+ *
+ * Returns: true if the letters and digits of the rope form a palindrome
+ */
+bool isPalindrome(const Rope& text) {
+    Rope::ChunkIterator forward = text.chunks().begin(), backward = text.reverseChunks().begin();
+    std::string_view front, back;
+    size_t fi = 0, bi = 0;               // Next byte in front; one past the next byte in back
+    size_t left = 0, right = text.size(); // Absolute positions of the two cursors
+    
+    while (left < right) {
+        // Advance each cursor to its next letter or digit
+        while (left < right) {
+            if (fi == front.size()) {
+                front = *forward;
+                ++forward;
+                fi = 0;
+            }
+            if (FOLD_ALNUM[(unsigned char)front[fi]]) break;
+            fi++;
+            left++;
+        }
+        while (left < right) {
+            if (bi == 0) {
+                back = *backward;
+                ++backward;
+                bi = back.size();
+            }
+            if (FOLD_ALNUM[(unsigned char)back[bi - 1]]) break;
+            bi--;
+            right--;
+        }
+        if (right - left < 2) return true;
+    
+        if (FOLD_ALNUM[(unsigned char)front[fi]] != FOLD_ALNUM[(unsigned char)back[bi - 1]]) return false;
+        fi++;
+        left++;
+        bi--;
+        right--;
+    }
+    return true;
+}
+
+/**
+ * reverseString - Reverse a rope in place
+ */
+void reverseString(Rope& text) {
+    text.reverse();
+}
+
+/**
+ * countVowelsAndConsonants - Count the character classes of a rope
+ */
+CharClassCounts countVowelsAndConsonants(const Rope& text) {
+    CharClassCounter counter;
+    for (std::string_view chunk : text.chunks()) counter.feed(chunk);
+    return counter.counts();
+}
+
+/**
+ * benchmarkRope - Random edits on a large document, std::string versus Rope
+ * @megabytes: Initial document size
+ * @edits: Number of edits; each inserts or erases 1-64 bytes at a random position
+ */
+void benchmarkRope(size_t megabytes, size_t edits) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(22);
+    std::string document(megabytes << 20, ' ');
+    for (char& c : document) c = "etaoin shrdlu,.\n"[rng() % 16];
+    
+    struct Edit {
+        bool insert;
+        double where; // Fraction of the current length
+        std::string text;
+        size_t length;
+    };
+    std::vector<Edit> script(edits);
+    for (Edit& e : script) {
+        e.insert = rng() % 2;
+        e.where = (double)rng() / 4294967296.0;
+        e.length = 1 + rng() % 64;
+        if (e.insert) e.text.assign(e.length, "abcdefgh"[rng() % 8]);
+    }
+    
+    std::string flat = document;
+    Rope rope(document);
+    auto apply = [&](auto& doc, size_t& size) {
+        for (const Edit& e : script) {
+            size_t pos = (size_t)(e.where * size);
+            if (e.insert) {
+                doc.insert(pos, e.text);
+                size += e.text.size();
+            } else {
+                size_t len = std::min(e.length, size - pos);
+                doc.erase(pos, len);
+                size -= len;
+            }
+        }
+    };
+    size_t flatSize = flat.size(), ropeSize = rope.size();
+    double tFlat = timeIt([&] { apply(flat, flatSize); });
+    double tRope = timeIt([&] { apply(rope, ropeSize); });
+    
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << edits << " random edits on a " << megabytes << " MB document:" << std::endl;
+    std::cout << "  std::string " << tFlat * 1e3 << " ms, Rope " << tRope * 1e3 << " ms ("
+              << rope.leafCount() << " chunks)" << (rope.toString() == flat ? "" : "  (MISMATCH)") << std::endl;
+    
+    // Whole-document algorithms: contiguous string versus chunk by chunk. The
+    // palindrome check gets a mirrored document with commas inserted at random
+    // (so both ends must be walked all the way to the middle)
+    std::string palindrome = flat.substr(0, flat.size() / 2);
+    palindrome.append(palindrome.rbegin(), palindrome.rend());
+    Rope palindromeRope(palindrome);
+    for (size_t k = 0; k < edits / 10; k++) {
+        size_t pos = rng() % (palindrome.size() + 1);
+        palindrome.insert(pos, ",");
+        palindromeRope.insert(pos, ",");
+    }
+    
+    std::string needle = "zzqz"; // Not in the document, so the whole text is searched
+    size_t foundFlat = 0, foundRope = 0;
+    CharClassCounts countsFlat, countsRope;
+    bool palindromeFlat = false, palindromeRopeResult = false;
+    double tFindFlat = timeIt([&] { foundFlat = SubstringSearcher(needle).find(flat); });
+    double tFindRope = timeIt([&] { foundRope = myStrStr(rope, needle); });
+    double tCountFlat = timeIt([&] { countsFlat = countCharClasses(flat); });
+    double tCountRope = timeIt([&] { countsRope = countVowelsAndConsonants(rope); });
+    double tPalFlat = timeIt([&] { palindromeFlat = isPalindromeFast(palindrome); });
+    double tPalRope = timeIt([&] { palindromeRopeResult = isPalindrome(palindromeRope); });
+    double tRevFlat = timeIt([&] { reverseBytes(&flat[0], flat.size()); });
+    double tRevRope = timeIt([&] { reverseString(rope); });
+    
+    std::cout << "Whole document (ms)    std::string    Rope" << std::endl;
+    auto row = [](const char* name, double a, double b, bool agree) {
+        std::cout << "  " << std::left << std::setw(21) << name << std::right << std::setw(11) << a * 1e3
+                  << std::setw(8) << b * 1e3 << (agree ? "" : "  (MISMATCH)") << std::endl;
+    };
+    row("myStrStr", tFindFlat, tFindRope, foundFlat == foundRope);
+    row("countVowels...", tCountFlat, tCountRope, countsFlat == countsRope);
+    row("isPalindrome", tPalFlat, tPalRope, palindromeFlat && palindromeRopeResult);
+    row("reverseString", tRevFlat, tRevRope, rope.toString() == flat);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        size_t megabytes = argc > 2 ? std::stoul(argv[2]) : 8;
+        size_t edits = argc > 3 ? std::stoul(argv[3]) : 10000;
+        benchmarkRope(megabytes, edits);
+        return 0;
+    }
+    
+    Rope text("A man, a plan, a canal: Panama");
+    std::cout << "Text: " << text.toString() << std::endl;
+    std::cout << "Is palindrome? " << (isPalindrome(text) ? "Yes" : "No") << std::endl;
+    
+    // Edit in the middle without touching the rest of the text
+    text.insert(15, "a cat, ");
+    std::cout << "\nAfter insert: " << text.toString() << std::endl;
+    std::cout << "Is palindrome? " << (isPalindrome(text) ? "Yes" : "No") << std::endl;
+    std::cout << "\"cat\" found at: " << myStrStr(text, "cat") << std::endl;
+    
+    text.erase(15, 7);
+    std::cout << "\nAfter erase: " << text.toString() << std::endl;
+    CharClassCounts counts = countVowelsAndConsonants(text);
+    std::cout << "Vowels: " << counts.vowels << "\nConsonants: " << counts.consonants << std::endl;
+    
+    reverseString(text);
+    std::cout << "\nReversed: " << text.toString() << std::endl;
+    
+    return 0;
+}
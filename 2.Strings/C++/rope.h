@@ -0,0 +1,338 @@
+/**
+ * Rope - Editable String Stored as a Balanced Tree of Chunks
+ *
+ * std::string keeps the whole text in one buffer, so inserting or erasing
+ * near the front of a multi-megabyte document moves everything after it.
+ * A Rope stores the text as a sequence of leaves of at most ROPE_LEAF_MAX
+ * bytes, kept in an implicit treap: in-order traversal of the tree gives
+ * the leaves in text order, every node knows how many bytes its subtree
+ * holds, and random priorities keep the tree O(log n) deep.
+ *
+ * insert and erase split the tree at the edit position (cutting at most
+ * one leaf in two), splice the new leaves in or drop the erased ones, and
+ * merge the pieces back, so an edit costs O(log n) tree steps plus
+ * O(ROPE_LEAF_MAX) bytes copied. Wherever two pieces are joined, leaves
+ * that fit together in one are merged, which keeps leaves from shrinking
+ * into many tiny fragments.
+ *
+ * The text is read without flattening through chunk iterators, which yield
+ * the leaves as string_views front to back (chunks) or back to front
+ * (reverseChunks):
+ *
+ *     Rope doc(text);
+ *     doc.insert(10, "new words ");
+ *     doc.erase(0, 4);
+ *     for (std::string_view chunk : doc.chunks()) counter.feed(chunk);
+ *
+ * Time Complexity: O(log n + ROPE_LEAF_MAX) per insert, erase or at,
+ *                  O(1) amortized per chunk while iterating
+ * Space Complexity: O(n)
+ */
+
+#ifndef ROPE_H
+#define ROPE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "reverseString.h"
+
+// Largest leaf; new text is cut into leaves of this size
+constexpr size_t ROPE_LEAF_MAX = 2048;
+
+class Rope {
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+public:
+    Rope() = default;
+    explicit Rope(std::string_view text) { root_ = build(text); }
+
+    size_t size() const { return bytes(root_); }
+    bool empty() const { return root_ == NIL; }
+    size_t leafCount() const { return nodes_.size() - free_.size(); }
+
+    /**
+     * insert - Insert text before position pos
+     * @pos: 0 to size(); throws std::out_of_range beyond that
+     */
+    void insert(size_t pos, std::string_view text) {
+        if (pos > size()) throw std::out_of_range("Rope insert position out of range");
+        if (text.empty()) return;
+        auto [left, right] = split(root_, pos);
+        root_ = join(join(left, build(text)), right);
+    }
+
+    void append(std::string_view text) { insert(size(), text); }
+
+    /**
+     * erase - Remove up to len bytes starting at pos
+     * @pos: 0 to size(); throws std::out_of_range beyond that
+     */
+    void erase(size_t pos, size_t len) {
+        if (pos > size()) throw std::out_of_range("Rope erase position out of range");
+        len = std::min(len, size() - pos);
+        if (len == 0) return;
+        auto [left, rest] = split(root_, pos);
+        auto [middle, right] = split(rest, len);
+        release(middle);
+        root_ = join(left, right);
+    }
+
+    /**
+     * at - The byte at position pos (O(log n))
+     */
+    char at(size_t pos) const {
+        if (pos >= size()) throw std::out_of_range("Rope index out of range");
+        uint32_t t = root_;
+        while (true) {
+            const Node& node = nodes_[t];
+            size_t leftBytes = bytes(node.left);
+            if (pos < leftBytes) {
+                t = node.left;
+            } else if (pos < leftBytes + node.text.size()) {
+                return node.text[pos - leftBytes];
+            } else {
+                pos -= leftBytes + node.text.size();
+                t = node.right;
+            }
+        }
+    }
+
+    /**
+     * toString - Flatten the rope into one contiguous string
+     */
+    std::string toString() const {
+        std::string out;
+        out.reserve(size());
+        for (std::string_view chunk : chunks()) out.append(chunk);
+        return out;
+    }
+
+    /**
+     * reverse - Reverse the text in place
+     *
+     * Mirroring every node reverses the order of the leaves, and each leaf
+     * is then byte-reversed with reverseBytes; subtree sizes are unchanged.
+     */
+    void reverse() {
+        for (Node& node : nodes_) {
+            std::swap(node.left, node.right);
+            reverseBytes(&node.text[0], node.text.size());
+        }
+    }
+
+    /**
+     * ChunkIterator - Walks the leaves in order (or in reverse order)
+     *
+     * Dereferencing gives the current leaf as a string_view; it stays valid
+     * until the rope is modified.
+     */
+    class ChunkIterator {
+    public:
+        ChunkIterator() = default;
+        ChunkIterator(const Rope* rope, bool backward) : rope_(rope), backward_(backward) {
+            descend(rope->root_);
+        }
+
+        std::string_view operator*() const { return rope_->nodes_[path_.back()].text; }
+
+        ChunkIterator& operator++() {
+            uint32_t t = path_.back();
+            path_.pop_back();
+            const Node& node = rope_->nodes_[t];
+            descend(backward_ ? node.left : node.right);
+            return *this;
+        }
+
+        bool operator==(const ChunkIterator& other) const { return path_ == other.path_; }
+        bool operator!=(const ChunkIterator& other) const { return !(*this == other); }
+
+    private:
+        // Push t and its chain of first children (leftmost, or rightmost when backward)
+        void descend(uint32_t t) {
+            while (t != NIL) {
+                path_.push_back(t);
+                const Node& node = rope_->nodes_[t];
+                t = backward_ ? node.right : node.left;
+            }
+        }
+
+        const Rope* rope_ = nullptr;
+        bool backward_ = false;
+        std::vector<uint32_t> path_; // Nodes whose leaf is still to come; back() is current
+    };
+
+    struct ChunkRange {
+        ChunkIterator first;
+        ChunkIterator begin() const { return first; }
+        ChunkIterator end() const { return ChunkIterator(); }
+    };
+
+    ChunkRange chunks() const { return ChunkRange{ChunkIterator(this, false)}; }
+    ChunkRange reverseChunks() const { return ChunkRange{ChunkIterator(this, true)}; }
+
+private:
+    struct Node {
+        std::string text;   // This node's leaf, never empty while the node is in use
+        uint32_t left = NIL;
+        uint32_t right = NIL;
+        uint32_t priority = 0;
+        size_t bytes = 0;   // Total text in this subtree
+    };
+
+    size_t bytes(uint32_t t) const { return t == NIL ? 0 : nodes_[t].bytes; }
+
+    void update(uint32_t t) {
+        Node& node = nodes_[t];
+        node.bytes = node.text.size() + bytes(node.left) + bytes(node.right);
+    }
+
+    uint32_t nextPriority() {
+        // xorshift32
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+    uint32_t newNode(std::string text) {
+        uint32_t t;
+        if (!free_.empty()) {
+            t = free_.back();
+            free_.pop_back();
+        } else {
+            t = (uint32_t)nodes_.size();
+            nodes_.emplace_back();
+        }
+        Node& node = nodes_[t];
+        node.text = std::move(text);
+        node.left = node.right = NIL;
+        node.priority = nextPriority();
+        node.bytes = node.text.size();
+        return t;
+    }
+
+    // Return every node of subtree t to the free list
+    void release(uint32_t t) {
+        std::vector<uint32_t> stack;
+        if (t != NIL) stack.push_back(t);
+        while (!stack.empty()) {
+            Node& node = nodes_[stack.back()];
+            free_.push_back(stack.back());
+            stack.pop_back();
+            if (node.left != NIL) stack.push_back(node.left);
+            if (node.right != NIL) stack.push_back(node.right);
+            std::string().swap(node.text);
+        }
+    }
+
+    // Tree of leaves holding text, cut into pieces of ROPE_LEAF_MAX bytes
+    uint32_t build(std::string_view text) {
+        uint32_t t = NIL;
+        for (size_t pos = 0; pos < text.size(); pos += ROPE_LEAF_MAX) {
+            t = merge(t, newNode(std::string(text.substr(pos, ROPE_LEAF_MAX))));
+        }
+        return t;
+    }
+
+    // Concatenate two trees (all of a comes before all of b)
+    uint32_t merge(uint32_t a, uint32_t b) {
+        if (a == NIL) return b;
+        if (b == NIL) return a;
+        if (nodes_[a].priority > nodes_[b].priority) {
+            uint32_t right = merge(nodes_[a].right, b);
+            nodes_[a].right = right;
+            update(a);
+            return a;
+        }
+        uint32_t left = merge(a, nodes_[b].left);
+        nodes_[b].left = left;
+        update(b);
+        return b;
+    }
+
+    // Split tree t into its first k bytes and the rest, cutting a leaf if needed
+    std::pair<uint32_t, uint32_t> split(uint32_t t, size_t k) {
+        if (t == NIL) return {NIL, NIL};
+        size_t leftBytes = bytes(nodes_[t].left);
+        size_t textSize = nodes_[t].text.size();
+
+        if (k <= leftBytes) {
+            auto [a, b] = split(nodes_[t].left, k);
+            nodes_[t].left = b;
+            update(t);
+            return {a, t};
+        }
+        if (k >= leftBytes + textSize) {
+            auto [a, b] = split(nodes_[t].right, k - leftBytes - textSize);
+            nodes_[t].right = a;
+            update(t);
+            return {t, b};
+        }
+
+        // The cut falls inside this node's leaf
+        size_t offset = k - leftBytes;
+        uint32_t tail = newNode(nodes_[t].text.substr(offset));
+        nodes_[t].text.resize(offset);
+        uint32_t left = nodes_[t].left, right = nodes_[t].right;
+        nodes_[t].left = nodes_[t].right = NIL;
+        update(t);
+        return {merge(left, t), merge(tail, right)};
+    }
+
+    size_t lastLeafSize(uint32_t t) const {
+        while (nodes_[t].right != NIL) t = nodes_[t].right;
+        return nodes_[t].text.size();
+    }
+
+    size_t firstLeafSize(uint32_t t) const {
+        while (nodes_[t].left != NIL) t = nodes_[t].left;
+        return nodes_[t].text.size();
+    }
+
+    // Remove the first leaf of t into taken; returns the new root
+    uint32_t popFirst(uint32_t t, std::string& taken) {
+        if (nodes_[t].left == NIL) {
+            uint32_t right = nodes_[t].right;
+            taken = std::move(nodes_[t].text);
+            nodes_[t].right = NIL;
+            release(t);
+            return right;
+        }
+        uint32_t left = popFirst(nodes_[t].left, taken);
+        nodes_[t].left = left;
+        update(t);
+        return t;
+    }
+
+    void appendToLast(uint32_t t, std::string_view text) {
+        if (nodes_[t].right == NIL) nodes_[t].text.append(text);
+        else appendToLast(nodes_[t].right, text);
+        update(t);
+    }
+
+    // merge, but fold the two leaves that meet at the seam into one when they fit
+    uint32_t join(uint32_t a, uint32_t b) {
+        if (a == NIL) return b;
+        if (b == NIL) return a;
+        if (lastLeafSize(a) + firstLeafSize(b) <= ROPE_LEAF_MAX) {
+            std::string first;
+            b = popFirst(b, first);
+            appendToLast(a, first);
+        }
+        return merge(a, b);
+    }
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> free_;
+    uint32_t root_ = NIL;
+    uint32_t seed_ = 2463534242u;
+};
+
+#endif // ROPE_H
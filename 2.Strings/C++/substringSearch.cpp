@@ -1,25 +1,48 @@
 /**
  * Substring Search
  * 
- * This program demonstrates two different approaches to search for a substring within a string:
+ * This program demonstrates different approaches to search for a substring within a string:
  * 1. A custom implementation similar to the C strstr function (brute force approach)
  * 2. Using the standard library's string::find method
+ * 3. SubstringSearcher (substringSearch.h), which preprocesses the needle and picks
+ *    a SIMD first/last-byte filter for short needles and Two-Way for long ones;
+ *    myStrStr uses it, and it can also stream every match offset of a large file;
+ *    findAllParallel / countParallel / findFirstParallel split one haystack across threads
+ * 4. AhoCorasick (substringSearch.h), which finds a whole dictionary of needles
+ *    in a single pass instead of one pass per needle
  * 
  * Time Complexity:
- * - Custom implementation (myStrStr): O(n*m) where n is the length of the haystack and m is the length of the needle
+ * - Brute force (myStrStrNaive): O(n*m) where n is the length of the haystack and m is the length of the needle
  * - STL implementation (string::find): Typically O(n*m) but can be more efficient with optimizations
+ * - SubstringSearcher: O(n) for long needles (Two-Way); short needles are filtered 16-32 positions at a time
+ * - AhoCorasick: O(n + total needle length + number of matches) for the whole dictionary
  * 
- * Space Complexity: O(1) for both implementations (constant extra space)
+ * Space Complexity: O(1) for the first two, O(m) for SubstringSearcher
  * 
  * Input: A haystack string "hello world" and a needle string "world"
  * Output: The position where the needle is found in the haystack, or string::npos if not found
+ *
+ * Benchmark: ./substringSearch --bench [megabytes]
+ * Find every match in a file: ./substringSearch --file <path> <needle>
+ * Count matches in a (multi-GB) file on all cores: ./substringSearch --count <path> <needle> [threads]
+ * Find every keyword (one per line) in a file: ./substringSearch --keywords <path> <keywords-file>
  */
 
 #include <iostream>  // For input/output operations
 #include <string>    // For string operations
+#include <cstring>   // For memmem
+#include <fstream>   // For streaming a file through MatchStream
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "substringSearch.h"
 
 /**
- * myStrStr - Find the first occurrence of a substring in a string (custom implementation)
+ * myStrStrNaive - Find the first occurrence of a substring in a string (custom implementation)
  * @haystack: The string to search in (passed by reference for efficiency)
  * @needle: The substring to search for (passed by reference for efficiency)
  * 
@@ -32,9 +55,10 @@
  * 
  * Returns: The position of the first occurrence, or string::npos if not found
  */
-size_t myStrStr(const std::string& haystack, const std::string& needle) {
+size_t myStrStrNaive(const std::string& haystack, const std::string& needle) {
     // Edge case: empty needle matches at position 0
     if (needle.empty()) return 0;
+    if (needle.length() > haystack.length()) return std::string::npos;
     
     // Try each potential starting position in the haystack
     // We only need to check positions up to (haystack.length() - needle.length())
@@ -54,6 +78,20 @@ size_t myStrStr(const std::string& haystack, const std::string& needle) {
     return std::string::npos;  // Special value indicating "not found"
 }
 
+/**
+ * myStrStr - Find the first occurrence of a substring in a string
+ * @haystack: The string to search in
+ * @needle: The substring to search for
+ * 
+ * Same contract as myStrStrNaive, but uses SubstringSearcher. To search for
+ * the same needle many times, build one SubstringSearcher and reuse it.
+ * 
+ * Returns: The position of the first occurrence, or string::npos if not found
+ */
+size_t myStrStr(const std::string& haystack, const std::string& needle) {
+    return SubstringSearcher(needle).find(haystack);
+}
+
 /**
  * findSubstring - Find the first occurrence of a substring using the STL
  * @haystack: The string to search in
@@ -70,7 +108,326 @@ size_t findSubstring(const std::string& haystack, const std::string& needle) {
     return haystack.find(needle);  // Use the built-in find method
 }
 
-int main() {
+/**
+ * memmemFind - Offset of the first match using the C library's memmem
+ */
+size_t memmemFind(const std::string& haystack, const std::string& needle) {
+#if defined(_GNU_SOURCE)
+    const void* hit = memmem(haystack.data(), haystack.size(), needle.data(), needle.size());
+    return hit ? (const char*)hit - haystack.data() : std::string::npos;
+#else
+    return haystack.find(needle);
+#endif
+}
+
+/**
+ * makeLogText - Build roughly @bytes of synthetic log lines
+ */
+std::string makeLogText(size_t bytes, std::mt19937& rng) {
+    static const char* levels[] = {"INFO ", "DEBUG", "WARN ", "ERROR"};
+    static const char* paths[] = {"/api/v1/items", "/api/v1/users", "/health", "/static/app.js", "/api/v2/search"};
+    std::string text;
+    text.reserve(bytes + 128);
+    auto pick = [&](unsigned n) { return (unsigned)(rng() % n); };
+    char line[160];
+    while (text.size() < bytes) {
+        int len = snprintf(line, sizeof(line),
+                           "2026-10-17T%02u:%02u:%02u.%03u %s [worker-%u] GET %s/%u status=%u took=%ums\n",
+                           pick(24), pick(60), pick(60), pick(1000), levels[pick(4)], pick(32), paths[pick(5)],
+                           pick(100000), 200 + pick(5) * 100, pick(900));
+        text.append(line, len);
+    }
+    return text;
+}
+
+/**
+ * benchmarkSubstringSearch - Compare myStrStrNaive, string::find, memmem and SubstringSearcher
+ * @megabytes: Size of the synthetic log text
+ * 
+ * Each needle is a slice of a log line with its last byte changed, planted
+ * once at the very end, so every method has to scan the whole text. Also
+ * counts all matches of a frequent needle, and times an adversarial input
+ * ("aaa...a" searched for "aa...ab") where the brute force is O(n*m).
+ */
+void benchmarkSubstringSearch(size_t megabytes) {
+    std::mt19937 rng(11);
+    std::string text = makeLogText(megabytes << 20, rng);
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::cout << "Haystack: " << text.size() / 1e6 << " MB of log lines; throughput in GB/s" << std::endl;
+    std::cout << "needle  naive   string::find  memmem  SubstringSearcher" << std::endl;
+    for (size_t m : {1, 4, 8, 16, 32, 64, 256, 1024}) {
+        size_t start = rng() % (text.size() / 2);
+        std::string needle = text.substr(start, m);
+        needle.back() = '~';
+        std::string haystack = text + needle;
+        size_t expected = text.size();
+        
+        SubstringSearcher searcher(needle);
+        size_t got[4];
+        double t[4];
+        t[0] = timeIt([&] { got[0] = myStrStrNaive(haystack, needle); });
+        t[1] = timeIt([&] { got[1] = haystack.find(needle); });
+        t[2] = timeIt([&] { got[2] = memmemFind(haystack, needle); });
+        t[3] = timeIt([&] { got[3] = searcher.find(haystack); });
+        
+        bool ok = true;
+        for (size_t r : got) ok = ok && r == expected;
+        std::cout << std::setw(6) << m;
+        for (double secs : t) std::cout << std::setw(9) << std::setprecision(3) << haystack.size() / secs * 1e-9;
+        std::cout << (ok ? "" : "  (MISMATCH)") << std::endl;
+    }
+    
+    // Find-all: every "ERROR" in the text
+    {
+        std::string needle = "ERROR";
+        size_t viaMemmem = 0, viaSearcher = 0;
+        double tMemmem = timeIt([&] {
+            for (size_t pos = memmemFind(text, needle); pos != std::string::npos;) {
+                viaMemmem++;
+                const char* hit = nullptr;
+#if defined(_GNU_SOURCE)
+                hit = (const char*)memmem(text.data() + pos + 1, text.size() - pos - 1, needle.data(), needle.size());
+#endif
+                pos = hit ? hit - text.data() : std::string::npos;
+            }
+        });
+        SubstringSearcher searcher(needle);
+        double tSearcher = timeIt([&] { viaSearcher = searcher.count(text); });
+        std::cout << "count \"ERROR\" (" << viaSearcher << " matches): memmem loop "
+                  << text.size() / tMemmem * 1e-9 << " GB/s, SubstringSearcher " << text.size() / tSearcher * 1e-9
+                  << " GB/s" << (viaMemmem == viaSearcher ? "" : "  (MISMATCH)") << std::endl;
+    }
+    
+    // Adversarial input for the brute force: almost-matches everywhere
+    std::string as(1 << 20, 'a');
+    for (size_t m : {16, 256}) {
+        std::string needle(m - 1, 'a');
+        needle += 'b';
+        SubstringSearcher searcher(needle);
+        size_t got[3];
+        double t[3];
+        t[0] = timeIt([&] { got[0] = myStrStrNaive(as, needle); });
+        t[1] = timeIt([&] { got[1] = memmemFind(as, needle); });
+        t[2] = timeIt([&] { got[2] = searcher.find(as); });
+        bool ok = got[0] == std::string::npos && got[1] == got[0] && got[2] == got[0];
+        std::cout << "\"a...a\" vs \"a...ab\" (m=" << m << "): naive " << as.size() / t[0] * 1e-9 << " GB/s, memmem "
+                  << as.size() / t[1] * 1e-9 << " GB/s, SubstringSearcher " << as.size() / t[2] * 1e-9 << " GB/s"
+                  << (ok ? "" : "  (MISMATCH)") << std::endl;
+    }
+}
+
+/**
+ * benchmarkDictionary - One findSubstring / SubstringSearcher pass per keyword vs one AhoCorasick pass
+ * @megabytes: Size of the synthetic log text
+ * 
+ * Keywords are random 4-12 byte slices of the text, so most of them occur.
+ * Total match counts must agree between the methods.
+ */
+void benchmarkDictionary(size_t megabytes) {
+    std::mt19937 rng(13);
+    std::string text = makeLogText(megabytes << 20, rng);
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::cout << "\nDictionary search over " << text.size() / 1e6 << " MB; seconds per pass over all keywords" << std::endl;
+    std::cout << "keywords  findSubstring  SubstringSearcher  AhoCorasick (build)" << std::endl;
+    for (size_t k : {10, 100, 1000, 10000}) {
+        std::vector<std::string> keywords;
+        for (size_t i = 0; i < k; i++) {
+            keywords.push_back(text.substr(rng() % (text.size() - 16), 4 + rng() % 9));
+        }
+        
+        size_t viaFind = 0, viaSearcher = 0, viaAutomaton = 0;
+        double tFind = -1, tSearcher = -1;
+        if (k <= 100) {
+            tFind = timeIt([&] {
+                for (const auto& w : keywords) {
+                    for (size_t pos = findSubstring(text, w); pos != std::string::npos; pos = text.find(w, pos + 1)) {
+                        viaFind++;
+                    }
+                }
+            });
+        }
+        if (k <= 1000) {
+            tSearcher = timeIt([&] {
+                for (const auto& w : keywords) viaSearcher += SubstringSearcher(w).count(text);
+            });
+        }
+        AhoCorasick* automaton = nullptr;
+        double tBuild = timeIt([&] { automaton = new AhoCorasick(keywords); });
+        double tScan = timeIt([&] { viaAutomaton = automaton->forEachMatch(text, [](size_t, size_t) {}); });
+        delete automaton;
+        
+        bool ok = (tFind < 0 || viaFind == viaAutomaton) && (tSearcher < 0 || viaSearcher == viaAutomaton);
+        auto seconds = [](double t) {
+            std::ostringstream out;
+            if (t < 0) out << "-"; else out << std::setprecision(3) << t;
+            return out.str();
+        };
+        std::cout << std::setw(8) << k << std::setw(15) << seconds(tFind) << std::setw(19) << seconds(tSearcher)
+                  << std::setw(13) << seconds(tScan) << " (" << seconds(tBuild) << ")  " << viaAutomaton << " matches"
+                  << (ok ? "" : "  (MISMATCH)") << std::endl;
+    }
+}
+
+/**
+ * benchmarkParallel - Throughput of the parallel searches for 1, 2, 4, ... threads
+ * @megabytes: Size of the synthetic log text
+ * 
+ * Counts every "status=500 took=1" (about one line in 4500) and finds one
+ * match planted in the middle of the text, checking both against the
+ * single-threaded searcher.
+ */
+void benchmarkParallel(size_t megabytes) {
+    std::mt19937 rng(17);
+    std::string text = makeLogText(megabytes << 20, rng);
+    SubstringSearcher common("status=500 took=1");
+    SubstringSearcher planted("status=700");
+    std::string needle = planted.needle();
+    text.replace(text.size() / 2, needle.size(), needle);
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    size_t expectedCount = common.count(text);
+    size_t expectedFirst = planted.find(text);
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "\nParallel search over " << text.size() / 1e6 << " MB (" << hardware << " hardware threads)"
+              << std::endl;
+    std::cout << "threads  findAll GB/s  count GB/s  first match (middle) GB/s" << std::endl;
+    for (unsigned t = 1;; t = std::min(2 * t, hardware)) {
+        std::vector<size_t> all;
+        size_t counted = 0, first = 0;
+        double tAll = timeIt([&] { all = findAllParallel(common, text, t); });
+        double tCount = timeIt([&] { counted = countParallel(common, text, t); });
+        double tFirst = timeIt([&] { first = findFirstParallel(planted, text, t); });
+        bool ok = all.size() == expectedCount && std::is_sorted(all.begin(), all.end()) &&
+                  counted == expectedCount && first == expectedFirst;
+        std::cout << std::setw(7) << t << std::setw(14) << text.size() / tAll * 1e-9 << std::setw(12)
+                  << text.size() / tCount * 1e-9 << std::setw(16) << expectedFirst / tFirst * 1e-9
+                  << (ok ? "" : "  (MISMATCH)") << std::endl;
+        if (t == hardware) break;
+    }
+}
+
+/**
+ * countInFile - Count the matches of @needle in a memory-mapped file on all cores
+ * 
+ * Returns: The number of matches
+ */
+size_t countInFile(const std::string& path, const std::string& needle, unsigned numThreads) {
+    MappedFile file(path);
+    SubstringSearcher searcher(needle);
+    auto start = std::chrono::steady_clock::now();
+    size_t matches = countParallel(searcher, file.view(), numThreads);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << file.size() / 1e9 << " GB in " << secs << " s (" << file.size() / secs * 1e-9 << " GB/s)"
+              << std::endl;
+    return matches;
+}
+
+/**
+ * searchFileForKeywords - Print "offset keyword" for every keyword match in a file
+ * @path: The file to scan; it is memory-mapped and read in a single pass
+ * @keywordsPath: One keyword per line
+ * 
+ * Returns: The number of matches
+ */
+size_t searchFileForKeywords(const std::string& path, const std::string& keywordsPath) {
+    std::ifstream in(keywordsPath);
+    if (!in) throw std::runtime_error("Cannot open " + keywordsPath);
+    std::vector<std::string> keywords;
+    for (std::string line; std::getline(in, line);) {
+        if (!line.empty()) keywords.push_back(line);
+    }
+    
+    AhoCorasick automaton(keywords);
+    MappedFile file(path);
+    return automaton.forEachMatch(file.view(), [&](size_t needle, size_t offset) {
+        std::cout << offset << " " << keywords[needle] << "\n";
+    });
+}
+
+/**
+ * searchFile - Print the offset of every match of @needle in a file
+ * 
+ * The file is read in 1 MB blocks and fed through a MatchStream, so memory
+ * use does not depend on the file size.
+ * 
+ * Returns: The number of matches, or -1 if the file cannot be opened
+ */
+long long searchFile(const std::string& path, const std::string& needle) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return -1;
+    
+    SubstringSearcher searcher(needle);
+    MatchStream stream(searcher);
+    std::vector<char> block(1 << 20);
+    long long matches = 0;
+    while (in) {
+        in.read(block.data(), block.size());
+        std::streamsize got = in.gcount();
+        if (got <= 0) break;
+        matches += stream.feed(std::string_view(block.data(), (size_t)got),
+                               [](size_t offset) { std::cout << offset << "\n"; });
+    }
+    return matches;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        size_t megabytes = argc > 2 ? std::stoul(argv[2]) : 256;
+        benchmarkSubstringSearch(megabytes);
+        benchmarkDictionary(std::max<size_t>(1, megabytes / 16));
+        benchmarkParallel(megabytes);
+        return 0;
+    }
+    if (argc > 3 && std::string(argv[1]) == "--file") {
+        if (argv[3][0] == '\0') {
+            std::cerr << "Needle must not be empty" << std::endl;
+            return 1;
+        }
+        long long matches = searchFile(argv[2], argv[3]);
+        if (matches < 0) {
+            std::cerr << "Cannot open " << argv[2] << std::endl;
+            return 1;
+        }
+        std::cerr << matches << " matches" << std::endl;
+        return 0;
+    }
+    if (argc > 3 && std::string(argv[1]) == "--count") {
+        try {
+            unsigned threads = argc > 4 ? (unsigned)std::stoul(argv[4]) : 0;
+            std::cout << countInFile(argv[2], argv[3], threads) << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (argc > 3 && std::string(argv[1]) == "--keywords") {
+        try {
+            std::cerr << searchFileForKeywords(argv[2], argv[3]) << " matches" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    
     // Test strings
     std::string haystack = "hello world";
     std::string needle = "world";
@@ -94,5 +451,29 @@ int main() {
         std::cout << "Substring not found (STL)" << std::endl;
     }
     
+    // Every occurrence, streamed from a searcher built once
+    std::string log = "GET /a 200\nGET /b 500\nPOST /c 500\nGET /d 200\n";
+    SubstringSearcher searcher(" 500");
+    std::cout << "\nOffsets of \" 500\" in the log:";
+    searcher.forEachMatch(log, [](size_t offset) { std::cout << " " << offset; });
+    std::cout << std::endl;
+    
+    // The same log fed in 7-byte chunks: matches across chunk boundaries are kept
+    MatchStream stream(searcher);
+    std::cout << "Streamed in 7-byte chunks:";
+    for (size_t i = 0; i < log.size(); i += 7) {
+        stream.feed(std::string_view(log).substr(i, 7), [](size_t offset) { std::cout << " " << offset; });
+    }
+    std::cout << std::endl;
+    
+    // Several needles in one pass; overlapping and nested matches are all reported
+    std::vector<std::string> keywords = {"he", "she", "his", "hers"};
+    AhoCorasick automaton(keywords);
+    std::cout << "\nKeywords in \"ushers\":";
+    automaton.forEachMatch("ushers", [&](size_t needle, size_t offset) {
+        std::cout << " " << keywords[needle] << "@" << offset;
+    });
+    std::cout << std::endl;
+    
     return 0;
-}
\ No newline at end of file
+}
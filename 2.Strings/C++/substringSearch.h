@@ -0,0 +1,931 @@
+/**
+ * Substring Search Engine
+ *
+ * SubstringSearcher preprocesses a needle once and then finds it in any number
+ * of haystacks, choosing a strategy by needle length:
+ *
+ * - 1 byte:          memchr
+ * - 2..32 bytes:     SIMD filter. Broadcast the first and last byte of the
+ *                    needle, compare 32 (AVX2) or 16 (SSE2) haystack positions
+ *                    at once against both, and run memcmp only where both
+ *                    ends match. On text this rejects almost every position
+ *                    without touching the needle.
+ * - over 32 bytes:   Two-Way (Crochemore-Perrin) with a last-byte shift table,
+ *                    which is linear in the worst case with O(1) extra state.
+ *                    The scan starts with the SIMD filter anyway, since it is
+ *                    faster on ordinary text, and hands over to Two-Way as soon
+ *                    as verification work exceeds a budget proportional to the
+ *                    bytes scanned so far.
+ *
+ * Every strategy reports all (overlapping) matches through a callback, so
+ * find() is "stop at the first match" and forEachMatch() / findAll() stream
+ * every offset. MatchStream runs a searcher over a sequence of chunks (for
+ * example blocks read from a multi-GB log file) and reports absolute offsets,
+ * including matches that straddle a chunk boundary.
+ *
+ * findAllParallel / countParallel / findFirstParallel split one haystack into
+ * overlapping chunks and search them on several threads.
+ *
+ * AhoCorasick finds a whole dictionary of needles in one pass, reporting
+ * (needle id, offset) pairs, and MappedFile exposes a file as a string_view
+ * so either searcher can scan it in place.
+ *
+ * Time Complexity: O(n) for needles over 32 bytes; O(n×m) worst case for the
+ *                  unbudgeted SIMD filter, which is only used while m <= 32
+ * Space Complexity: O(m) for the needle copy plus a 256-entry shift table
+ */
+
+#ifndef SUBSTRING_SEARCH_H
+#define SUBSTRING_SEARCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Needles up to this length use the SIMD first/last-byte filter; longer ones use Two-Way
+constexpr size_t SIMD_FILTER_MAX_NEEDLE = 32;
+
+// Long needles fall back to Two-Way once the filter has charged this many
+// verified bytes per scanned byte (plus a fixed allowance)
+constexpr size_t SIMD_FILTER_BUDGET_RATIO = 4;
+constexpr size_t SIMD_FILTER_BUDGET_SLACK = 1 << 16;
+
+namespace substring_detail {
+
+/**
+ * reportMatch - Pass a match to a callback that may or may not return bool
+ *
+ * Returns: false if the callback asked to stop (returned false)
+ */
+template <typename F>
+inline bool reportMatch(F& onMatch, size_t pos) {
+    if constexpr (std::is_void<decltype(onMatch(pos))>::value) {
+        onMatch(pos);
+        return true;
+    } else {
+        return static_cast<bool>(onMatch(pos));
+    }
+}
+
+// reportMatch for callbacks taking (needle, offset)
+template <typename F>
+inline bool reportMatch2(F& onMatch, size_t needle, size_t offset) {
+    if constexpr (std::is_void<decltype(onMatch(needle, offset))>::value) {
+        onMatch(needle, offset);
+        return true;
+    } else {
+        return static_cast<bool>(onMatch(needle, offset));
+    }
+}
+
+/**
+ * criticalFactorization - Split a needle for the Two-Way algorithm
+ * @x: The needle
+ * @m: Needle length (at least 1)
+ * @period: Set to the period of the right half
+ *
+ * Computes the maximal suffix of the needle under the normal and the reversed
+ * byte order and keeps the longer of the two; its start is a critical
+ * position, where the local period equals the global period.
+ *
+ * Returns: The index where the right half starts
+ */
+inline size_t criticalFactorization(const unsigned char* x, size_t m, size_t* period) {
+    size_t maxSuffix = SIZE_MAX, j = 0, k = 1, p = 1;
+    while (j + k < m) {
+        unsigned char a = x[j + k], b = x[maxSuffix + k];
+        if (a < b) {
+            j += k;
+            k = 1;
+            p = j - maxSuffix;
+        } else if (a == b) {
+            if (k != p) {
+                ++k;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            maxSuffix = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+
+    size_t maxSuffixRev = SIZE_MAX;
+    j = 0;
+    k = p = 1;
+    while (j + k < m) {
+        unsigned char a = x[j + k], b = x[maxSuffixRev + k];
+        if (b < a) {
+            j += k;
+            k = 1;
+            p = j - maxSuffixRev;
+        } else if (a == b) {
+            if (k != p) {
+                ++k;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            maxSuffixRev = j++;
+            k = p = 1;
+        }
+    }
+
+    // SIZE_MAX + 1 wraps to 0, which is what we want for "no suffix found"
+    if (maxSuffixRev + 1 < maxSuffix + 1) return maxSuffix + 1;
+    *period = p;
+    return maxSuffixRev + 1;
+}
+
+} // namespace substring_detail
+
+/**
+ * SubstringSearcher - A needle preprocessed for repeated searching
+ *
+ * The searcher keeps its own copy of the needle, so it stays valid after the
+ * string it was built from goes away.
+ */
+class SubstringSearcher {
+public:
+    enum class Strategy { Empty, SingleByte, SimdFilter, TwoWay };
+
+    explicit SubstringSearcher(std::string_view needle) : needle_(needle) {
+        size_t m = needle_.size();
+        if (m == 0) {
+            strategy_ = Strategy::Empty;
+        } else if (m == 1) {
+            strategy_ = Strategy::SingleByte;
+        } else if (m <= SIMD_FILTER_MAX_NEEDLE) {
+            strategy_ = Strategy::SimdFilter;
+        } else {
+            strategy_ = Strategy::TwoWay;
+            prepareTwoWay();
+        }
+    }
+
+    const std::string& needle() const { return needle_; }
+    size_t size() const { return needle_.size(); }
+    Strategy strategy() const { return strategy_; }
+
+    /**
+     * find - Position of the first match at or after @from
+     *
+     * Returns: The offset of the match, or std::string::npos if there is none
+     */
+    size_t find(std::string_view haystack, size_t from = 0) const {
+        size_t found = std::string::npos;
+        forEachMatch(haystack, [&](size_t pos) {
+            found = pos;
+            return false;
+        }, from);
+        return found;
+    }
+
+    /**
+     * forEachMatch - Call @onMatch(offset) for every match, in increasing order
+     * @haystack: The text to search
+     * @onMatch: Callback; if it returns bool, returning false stops the search
+     * @from: First offset at which a match may start
+     *
+     * Overlapping matches are all reported ("aa" occurs 3 times in "aaaa").
+     * An empty needle matches at every offset from @from to haystack.size().
+     *
+     * Returns: The number of matches reported
+     */
+    template <typename F>
+    size_t forEachMatch(std::string_view haystack, F&& onMatch, size_t from = 0) const {
+        size_t count = 0;
+        auto counted = [&](size_t pos) {
+            ++count;
+            return substring_detail::reportMatch(onMatch, pos);
+        };
+        if (from > haystack.size() || haystack.size() - from < needle_.size()) return 0;
+
+        const unsigned char* h = reinterpret_cast<const unsigned char*>(haystack.data());
+        switch (strategy_) {
+            case Strategy::Empty:
+                for (size_t i = from; i <= haystack.size(); i++) {
+                    if (!counted(i)) break;
+                }
+                break;
+            case Strategy::SingleByte:
+                scanSingleByte(h, from, haystack.size(), counted);
+                break;
+            case Strategy::SimdFilter:
+                scanSimdFilter<false>(h, from, haystack.size(), counted);
+                break;
+            case Strategy::TwoWay:
+                scanSimdFilter<true>(h, from, haystack.size(), counted);
+                break;
+        }
+        return count;
+    }
+
+    /**
+     * findAll - Offsets of every (overlapping) match
+     */
+    std::vector<size_t> findAll(std::string_view haystack) const {
+        std::vector<size_t> out;
+        forEachMatch(haystack, [&](size_t pos) { out.push_back(pos); });
+        return out;
+    }
+
+    /**
+     * count - Number of (overlapping) matches
+     */
+    size_t count(std::string_view haystack) const {
+        return forEachMatch(haystack, [](size_t) {});
+    }
+
+private:
+    template <typename F>
+    void scanSingleByte(const unsigned char* h, size_t from, size_t n, F& onMatch) const {
+        const void* start = h + from;
+        while (const void* hit = std::memchr(start, needle_[0], n - ((const unsigned char*)start - h))) {
+            size_t pos = (const unsigned char*)hit - h;
+            if (!onMatch(pos)) return;
+            if (pos + 1 == n) return;
+            start = h + pos + 1;
+        }
+    }
+
+    /**
+     * scanSimdFilter - Compare 32 (or 16) candidate positions per step
+     *
+     * With Budgeted set, every verified candidate is charged m bytes, and once
+     * the charge outgrows the bytes scanned the rest of the haystack is handed
+     * to scanTwoWay, which keeps the total work linear.
+     */
+    template <bool Budgeted, typename F>
+    void scanSimdFilter(const unsigned char* h, size_t from, size_t n, F& onMatch) const {
+        const unsigned char* x = reinterpret_cast<const unsigned char*>(needle_.data());
+        size_t m = needle_.size();
+        size_t i = from;
+        size_t charged = 0;
+
+        // 0: keep going, 1: the callback asked to stop, 2: Two-Way took over from pos
+        auto verify = [&](size_t pos) {
+            if (Budgeted) {
+                charged += m;
+                if (charged > SIMD_FILTER_BUDGET_RATIO * (pos - from) + SIMD_FILTER_BUDGET_SLACK) {
+                    scanTwoWay(h, pos, n, onMatch);
+                    return 2;
+                }
+            }
+            if (std::memcmp(h + pos + 1, x + 1, m - 2) == 0 && !onMatch(pos)) return 1;
+            return 0;
+        };
+
+#if defined(__AVX2__)
+        const __m256i first = _mm256_set1_epi8((char)x[0]);
+        const __m256i last = _mm256_set1_epi8((char)x[m - 1]);
+        for (; i + m + 31 <= n; i += 32) {
+            __m256i blockFirst = _mm256_loadu_si256((const __m256i*)(h + i));
+            __m256i blockLast = _mm256_loadu_si256((const __m256i*)(h + i + m - 1));
+            __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first),
+                                          _mm256_cmpeq_epi8(blockLast, last));
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+            while (mask) {
+                if (verify(i + __builtin_ctz(mask))) return;
+                mask &= mask - 1;
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i first = _mm_set1_epi8((char)x[0]);
+        const __m128i last = _mm_set1_epi8((char)x[m - 1]);
+        for (; i + m + 15 <= n; i += 16) {
+            __m128i blockFirst = _mm_loadu_si128((const __m128i*)(h + i));
+            __m128i blockLast = _mm_loadu_si128((const __m128i*)(h + i + m - 1));
+            __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last));
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(eq);
+            while (mask) {
+                if (verify(i + __builtin_ctz(mask))) return;
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        // Tail (or the whole scan without SIMD)
+        for (; i + m <= n; i++) {
+            if (h[i] == x[0] && h[i + m - 1] == x[m - 1] && verify(i)) return;
+        }
+    }
+
+    void prepareTwoWay() {
+        const unsigned char* x = reinterpret_cast<const unsigned char*>(needle_.data());
+        size_t m = needle_.size();
+        suffix_ = substring_detail::criticalFactorization(x, m, &period_);
+        periodic_ = std::memcmp(x, x + period_, suffix_) == 0;
+        if (!periodic_) period_ = std::max(suffix_, m - suffix_) + 1;
+
+        // shift_[c]: how far the window may move when its last byte is c
+        for (size_t& s : shift_) s = m;
+        for (size_t i = 0; i < m; i++) shift_[x[i]] = m - 1 - i;
+    }
+
+    template <typename F>
+    void scanTwoWay(const unsigned char* h, size_t from, size_t n, F& onMatch) const {
+        const unsigned char* x = reinterpret_cast<const unsigned char*>(needle_.data());
+        size_t m = needle_.size();
+        size_t j = from;
+
+        if (periodic_) {
+            // A mismatch in the left half only advances by the period, so
+            // remember how much of the needle's prefix is already known to match
+            size_t memory = 0;
+            while (j + m <= n) {
+                size_t shift = shift_[h[j + m - 1]];
+                if (shift > 0) {
+                    if (memory && shift < period_) shift = m - period_;
+                    memory = 0;
+                    j += shift;
+                    continue;
+                }
+                size_t i = std::max(suffix_, memory);
+                while (i < m - 1 && x[i] == h[i + j]) ++i;
+                if (i >= m - 1) {
+                    i = suffix_ - 1;
+                    while (memory < i + 1 && x[i] == h[i + j]) --i;
+                    if (i + 1 < memory + 1 && !onMatch(j)) return;
+                    j += period_;
+                    memory = m - period_;
+                } else {
+                    j += i - suffix_ + 1;
+                    memory = 0;
+                }
+            }
+        } else {
+            while (j + m <= n) {
+                size_t shift = shift_[h[j + m - 1]];
+                if (shift > 0) {
+                    j += shift;
+                    continue;
+                }
+                size_t i = suffix_;
+                while (i < m - 1 && x[i] == h[i + j]) ++i;
+                if (i >= m - 1) {
+                    i = suffix_ - 1;
+                    while (i != SIZE_MAX && x[i] == h[i + j]) --i;
+                    if (i == SIZE_MAX && !onMatch(j)) return;
+                    j += period_;
+                } else {
+                    j += i - suffix_ + 1;
+                }
+            }
+        }
+    }
+
+    std::string needle_;
+    Strategy strategy_ = Strategy::Empty;
+
+    // Two-Way state
+    size_t suffix_ = 0;
+    size_t period_ = 1;
+    bool periodic_ = false;
+    size_t shift_[256] = {};
+};
+
+/**
+ * MatchStream - Run a searcher over consecutive chunks of one long text
+ *
+ * Feed the text in pieces of any size; matches are reported with their offset
+ * from the start of the whole text. The last m-1 bytes of each chunk are kept
+ * so that a match straddling two chunks is still found; nothing else is
+ * copied.
+ *
+ *     SubstringSearcher searcher("ERROR");
+ *     MatchStream stream(searcher);
+ *     while (readBlock(file, block)) {
+ *         stream.feed(block, [](size_t offset) { std::cout << offset << '\n'; });
+ *     }
+ */
+class MatchStream {
+public:
+    explicit MatchStream(const SubstringSearcher& searcher) : searcher_(searcher) {
+        if (searcher.size() == 0) {
+            throw std::invalid_argument("MatchStream needs a non-empty needle");
+        }
+    }
+
+    /**
+     * feed - Search the next chunk of the text
+     * @chunk: Bytes that follow everything fed so far
+     * @onMatch: Callback taking the absolute offset of each match
+     *
+     * Returns: The number of matches reported for this chunk
+     */
+    template <typename F>
+    size_t feed(std::string_view chunk, F&& onMatch) {
+        size_t keep = searcher_.size() - 1;
+        size_t found = 0;
+
+        // Matches that start in the carried tail and end inside this chunk
+        if (!carry_.empty()) {
+            window_.assign(carry_);
+            window_.append(chunk.substr(0, std::min(chunk.size(), keep)));
+            size_t carryLen = carry_.size();
+            size_t carryStart = consumed_ - carryLen;
+            searcher_.forEachMatch(window_, [&](size_t pos) {
+                if (pos >= carryLen) return false;
+                ++found;
+                onMatch(carryStart + pos);
+                return true;
+            });
+        }
+
+        found += searcher_.forEachMatch(chunk, [&](size_t pos) { onMatch(consumed_ + pos); });
+
+        if (chunk.size() >= keep) {
+            carry_.assign(chunk.substr(chunk.size() - keep));
+        } else {
+            carry_.append(chunk);
+            if (carry_.size() > keep) carry_.erase(0, carry_.size() - keep);
+        }
+        consumed_ += chunk.size();
+        return found;
+    }
+
+    // Total number of bytes fed so far
+    size_t consumed() const { return consumed_; }
+
+private:
+    const SubstringSearcher& searcher_;
+    std::string carry_;
+    std::string window_;
+    size_t consumed_ = 0;
+};
+
+/**
+ * Parallel search
+ *
+ * The haystack is cut into chunks of PARALLEL_SEARCH_CHUNK bytes, and each
+ * chunk is searched together with the first m-1 bytes of the next one, so a
+ * match is found by exactly the chunk it starts in. Worker threads take
+ * chunks from a shared counter in increasing order, which balances the load
+ * and lets findFirstParallel skip every chunk that starts after a match that
+ * has already been found.
+ */
+
+// Bytes per chunk; small enough that a cancelled worker stops within about a millisecond
+constexpr size_t PARALLEL_SEARCH_CHUNK = 1 << 22;
+
+namespace substring_detail {
+
+/**
+ * forEachChunk - Run fn(chunk, begin, end) for every chunk of [0, n) on numThreads threads
+ *
+ * The calling thread works too, so numThreads == 1 runs everything inline.
+ */
+template <typename Fn>
+void forEachChunk(size_t n, size_t chunkSize, unsigned numThreads, Fn fn) {
+    size_t chunks = (n + chunkSize - 1) / chunkSize;
+    if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = (unsigned)std::min<size_t>(numThreads, chunks);
+
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t c; (c = next.fetch_add(1, std::memory_order_relaxed)) < chunks;) {
+            fn(c, c * chunkSize, std::min(n, (c + 1) * chunkSize));
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < numThreads; t++) workers.emplace_back(worker);
+    worker();
+    for (auto& w : workers) w.join();
+}
+
+} // namespace substring_detail
+
+/**
+ * findAllParallel - Offsets of every (overlapping) match, searched on several threads
+ * @searcher: The preprocessed needle
+ * @haystack: The text to search
+ * @numThreads: Number of threads (0 = one per hardware thread)
+ * @chunkSize: Bytes per chunk
+ *
+ * Returns: The same offsets as searcher.findAll(haystack), in increasing order
+ */
+inline std::vector<size_t> findAllParallel(const SubstringSearcher& searcher, std::string_view haystack,
+                                           unsigned numThreads = 0, size_t chunkSize = PARALLEL_SEARCH_CHUNK) {
+    if (searcher.size() == 0 || chunkSize == 0) return searcher.findAll(haystack);
+
+    size_t overlap = searcher.size() - 1;
+    std::vector<std::vector<size_t>> perChunk((haystack.size() + chunkSize - 1) / chunkSize);
+    substring_detail::forEachChunk(haystack.size(), chunkSize, numThreads, [&](size_t c, size_t begin, size_t end) {
+        searcher.forEachMatch(haystack.substr(begin, end - begin + overlap),
+                              [&](size_t pos) { perChunk[c].push_back(begin + pos); });
+    });
+
+    // Chunks cover increasing ranges, so concatenating them keeps the offsets sorted
+    size_t total = 0;
+    for (const auto& offsets : perChunk) total += offsets.size();
+    std::vector<size_t> out;
+    out.reserve(total);
+    for (const auto& offsets : perChunk) out.insert(out.end(), offsets.begin(), offsets.end());
+    return out;
+}
+
+/**
+ * countParallel - Number of (overlapping) matches, searched on several threads
+ */
+inline size_t countParallel(const SubstringSearcher& searcher, std::string_view haystack, unsigned numThreads = 0,
+                            size_t chunkSize = PARALLEL_SEARCH_CHUNK) {
+    if (searcher.size() == 0 || chunkSize == 0) return searcher.count(haystack);
+
+    size_t overlap = searcher.size() - 1;
+    std::atomic<size_t> total{0};
+    substring_detail::forEachChunk(haystack.size(), chunkSize, numThreads, [&](size_t, size_t begin, size_t end) {
+        total += searcher.count(haystack.substr(begin, end - begin + overlap));
+    });
+    return total;
+}
+
+/**
+ * findFirstParallel - Offset of the first match, searched on several threads
+ *
+ * Once any worker finds a match, every chunk that starts after it is skipped,
+ * so the workers stop within one chunk of the first match instead of scanning
+ * the whole haystack.
+ *
+ * Returns: The same offset as searcher.find(haystack), or std::string::npos
+ */
+inline size_t findFirstParallel(const SubstringSearcher& searcher, std::string_view haystack, unsigned numThreads = 0,
+                                size_t chunkSize = PARALLEL_SEARCH_CHUNK) {
+    if (searcher.size() == 0 || chunkSize == 0) return searcher.find(haystack);
+
+    size_t overlap = searcher.size() - 1;
+    std::atomic<size_t> best{std::string::npos};
+    substring_detail::forEachChunk(haystack.size(), chunkSize, numThreads, [&](size_t, size_t begin, size_t end) {
+        if (begin >= best.load(std::memory_order_relaxed)) return;
+        size_t pos = searcher.find(haystack.substr(begin, end - begin + overlap));
+        if (pos == std::string::npos) return;
+        size_t found = begin + pos;
+        size_t current = best.load();
+        while (found < current && !best.compare_exchange_weak(current, found)) {
+        }
+    });
+    return best;
+}
+
+/**
+ * AhoCorasick - Find every occurrence of every needle of a dictionary in one pass
+ *
+ * The needles are inserted into a trie, and each trie node gets a failure link
+ * to the longest proper suffix of its string that is also a trie node. The
+ * scan follows one transition per text byte and falls back along failure
+ * links on a miss, so the whole text is read once however many needles there
+ * are: O(n + total needle length + number of matches).
+ *
+ * Transitions are stored as a double array. Every state is a cell; the child
+ * of state s for byte c is cell base[s] + c + 1, valid only if that cell's
+ * check field equals s. Each cell also holds the state's failure link and
+ * the first state to report from, so a transition and the data needed after
+ * it share one 16-byte cell, and the table is a handful of bytes per trie node
+ * instead of 256 pointers.
+ *
+ * Matches are reported in order of their end position; among matches ending
+ * at the same byte, longer needles come first. Empty needles never match.
+ */
+class AhoCorasick {
+public:
+    struct Match {
+        size_t needle;  // Index into the dictionary passed to the constructor
+        size_t offset;  // Offset of the first byte of the match
+    };
+
+    explicit AhoCorasick(const std::vector<std::string>& needles) {
+        build(std::vector<std::string_view>(needles.begin(), needles.end()));
+    }
+
+    explicit AhoCorasick(const std::vector<std::string_view>& needles) { build(needles); }
+
+    size_t needleCount() const { return needleLength_.size(); }
+    size_t stateCount() const { return stateCount_; }
+
+    // Bytes used by the transition table and the output lists
+    size_t tableBytes() const {
+        return cells_.size() * sizeof(Cell) + (nextReport_.size() + outBegin_.size() + outIds_.size()) * sizeof(int32_t);
+    }
+
+    /**
+     * forEachMatch - Call @onMatch(needle, offset) for every match in @text
+     * @onMatch: Callback; if it returns bool, returning false stops the scan
+     *
+     * Returns: The number of matches reported
+     */
+    template <typename F>
+    size_t forEachMatch(std::string_view text, F&& onMatch) const {
+        size_t count = 0;
+        scan(text, 0, 0, [&](size_t needle, size_t offset) {
+            ++count;
+            return substring_detail::reportMatch2(onMatch, needle, offset);
+        });
+        return count;
+    }
+
+    /**
+     * findAll - Every (needle, offset) pair in @text
+     */
+    std::vector<Match> findAll(std::string_view text) const {
+        std::vector<Match> out;
+        forEachMatch(text, [&](size_t needle, size_t offset) { out.push_back({needle, offset}); });
+        return out;
+    }
+
+    /**
+     * Stream - Scan a text that arrives in chunks
+     *
+     * The automaton state carries over from one chunk to the next, so matches
+     * that straddle chunk boundaries are found without copying anything.
+     */
+    class Stream {
+    public:
+        explicit Stream(const AhoCorasick& automaton) : automaton_(automaton) {}
+
+        /**
+         * feed - Scan the next chunk; offsets are relative to the start of the text
+         *
+         * Returns: The number of matches reported for this chunk
+         */
+        template <typename F>
+        size_t feed(std::string_view chunk, F&& onMatch) {
+            size_t count = 0;
+            state_ = automaton_.scan(chunk, state_, consumed_, [&](size_t needle, size_t offset) {
+                ++count;
+                onMatch(needle, offset);
+                return true;
+            });
+            consumed_ += chunk.size();
+            return count;
+        }
+
+        size_t consumed() const { return consumed_; }
+
+    private:
+        const AhoCorasick& automaton_;
+        int32_t state_ = 0;
+        size_t consumed_ = 0;
+    };
+
+private:
+    struct Cell {
+        int32_t base = 0;     // Children of this state live at base + byte + 1
+        int32_t check = -1;   // Parent state of this cell, or -1 if the cell is free
+        int32_t fail = 0;     // Failure link
+        int32_t report = -1;  // First state on the failure chain (self included) that ends a needle
+    };
+
+    /**
+     * scan - Run the automaton over @text starting in @state
+     * @base: Offset of text[0] within the whole input
+     *
+     * Returns: The state after the last byte, or -1 if @onMatch stopped the scan
+     */
+    template <typename F>
+    int32_t scan(std::string_view text, int32_t state, size_t base, F&& onMatch) const {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(text.data());
+        const Cell* cells = cells_.data();
+        int32_t s = state;
+        for (size_t i = 0; i < text.size(); i++) {
+            int32_t c = p[i] + 1;
+            for (;;) {
+                int32_t t = cells[s].base + c;
+                if (cells[t].check == s) {
+                    s = t;
+                    break;
+                }
+                if (s == 0) break;
+                s = cells[s].fail;
+            }
+            for (int32_t r = cells[s].report; r >= 0; r = nextReport_[r]) {
+                for (int32_t k = outBegin_[r]; k < outBegin_[r + 1]; k++) {
+                    size_t needle = (size_t)outIds_[k];
+                    if (!onMatch(needle, base + i + 1 - needleLength_[needle])) return -1;
+                }
+            }
+        }
+        return s;
+    }
+
+    void build(const std::vector<std::string_view>& needles) {
+        // 1. Plain trie; node 0 is the root
+        struct TrieNode {
+            std::vector<std::pair<unsigned char, int32_t>> children;
+            std::vector<int32_t> ids;
+        };
+        std::vector<TrieNode> trie(1);
+        needleLength_.resize(needles.size());
+        for (size_t id = 0; id < needles.size(); id++) {
+            needleLength_[id] = needles[id].size();
+            if (needles[id].empty()) continue;
+            int32_t node = 0;
+            for (unsigned char c : needles[id]) {
+                auto& kids = trie[node].children;
+                auto it = std::find_if(kids.begin(), kids.end(), [c](const auto& kid) { return kid.first == c; });
+                if (it == kids.end()) {
+                    kids.emplace_back(c, (int32_t)trie.size());
+                    node = (int32_t)trie.size();
+                    trie.emplace_back();
+                } else {
+                    node = it->second;
+                }
+            }
+            trie[node].ids.push_back((int32_t)id);
+        }
+        stateCount_ = trie.size();
+
+        // 2. Place the trie into the double array in breadth-first order and
+        //    compute failure links on the way (a failure link always points to
+        //    a shallower state, which has already been placed)
+        std::vector<int32_t> cellOf(trie.size(), -1);
+        cellOf[0] = 0;
+
+        // Free cells are kept in a doubly linked list so placing a node only
+        // looks at free cells; the array always ends in at least 257 free cells
+        std::vector<int32_t> freeNext, freePrev;
+        int32_t freeHead = -1, freeTail = -1;
+        auto grow = [&](size_t size) {
+            size_t old = cells_.size();
+            cells_.resize(size);
+            freeNext.resize(size);
+            freePrev.resize(size);
+            for (size_t i = old; i < size; i++) {
+                freePrev[i] = freeTail;
+                freeNext[i] = -1;
+                if (freeTail >= 0) freeNext[freeTail] = (int32_t)i; else freeHead = (int32_t)i;
+                freeTail = (int32_t)i;
+            }
+        };
+        auto occupy = [&](int32_t t, int32_t parent) {
+            cells_[t].check = parent;
+            if (freePrev[t] >= 0) freeNext[freePrev[t]] = freeNext[t]; else freeHead = freeNext[t];
+            if (freeNext[t] >= 0) freePrev[freeNext[t]] = freePrev[t]; else freeTail = freePrev[t];
+        };
+        cells_.clear();
+        grow(2 * 257);
+        occupy(0, 0);  // The root is its own parent so its cell is never handed out
+
+        auto childOf = [&](int32_t s, int32_t c) {
+            int32_t t = cells_[s].base + c;
+            return (t < (int32_t)cells_.size() && cells_[t].check == s) ? t : -1;
+        };
+
+        std::vector<int32_t> queue = {0};
+        for (size_t head = 0; head < queue.size(); head++) {
+            int32_t node = queue[head];
+            int32_t s = cellOf[node];
+            auto& kids = trie[node].children;
+            if (kids.empty()) continue;
+            std::sort(kids.begin(), kids.end());
+
+            // First free cell that can hold the smallest child byte and leaves
+            // the slots for all other child bytes free
+            int32_t first = kids[0].first + 1;
+            int32_t b = -1;
+            for (int32_t p = freeHead; b < 0; p = freeNext[p]) {
+                int32_t candidate = p - first;
+                if (candidate < 1) continue;
+                if ((size_t)candidate + 257 > cells_.size()) {
+                    grow(std::max((size_t)candidate + 257, cells_.size() + cells_.size() / 2));
+                }
+                bool fits = true;
+                for (const auto& kid : kids) {
+                    if (cells_[candidate + kid.first + 1].check != -1) {
+                        fits = false;
+                        break;
+                    }
+                }
+                if (fits) b = candidate;
+            }
+            cells_[s].base = b;
+
+            for (const auto& kid : kids) {
+                int32_t c = kid.first + 1;
+                int32_t t = b + c;
+                occupy(t, s);
+                cellOf[kid.second] = t;
+
+                int32_t f = 0;
+                if (s != 0) {
+                    int32_t g = cells_[s].fail;
+                    for (;;) {
+                        int32_t next = childOf(g, c);
+                        if (next >= 0) {
+                            f = next;
+                            break;
+                        }
+                        if (g == 0) break;
+                        g = cells_[g].fail;
+                    }
+                }
+                cells_[t].fail = f;
+                queue.push_back(kid.second);
+            }
+        }
+        cells_.resize(cells_.size() + 257);  // base + c stays in range for every state
+        cells_.shrink_to_fit();
+
+        // 3. Output lists: needle ids per state, and a link to the next state
+        //    down the failure chain that also ends a needle
+        outBegin_.assign(cells_.size() + 1, 0);
+        for (size_t node = 0; node < trie.size(); node++) {
+            outBegin_[cellOf[node] + 1] = (int32_t)trie[node].ids.size();
+        }
+        for (size_t i = 1; i < outBegin_.size(); i++) outBegin_[i] += outBegin_[i - 1];
+        outIds_.resize(outBegin_.back());
+        for (size_t node = 0; node < trie.size(); node++) {
+            std::copy(trie[node].ids.begin(), trie[node].ids.end(), outIds_.begin() + outBegin_[cellOf[node]]);
+        }
+
+        nextReport_.assign(cells_.size(), -1);
+        for (int32_t node : queue) {
+            int32_t s = cellOf[node];
+            if (s == 0) continue;
+            int32_t inherited = cells_[cells_[s].fail].report;
+            if (!trie[node].ids.empty()) {
+                cells_[s].report = s;
+                nextReport_[s] = inherited;
+            } else {
+                cells_[s].report = inherited;
+            }
+        }
+    }
+
+    std::vector<Cell> cells_;
+    std::vector<int32_t> nextReport_;
+    std::vector<int32_t> outBegin_;
+    std::vector<int32_t> outIds_;
+    std::vector<size_t> needleLength_;
+    size_t stateCount_ = 0;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * MappedFile - Read-only memory mapping of a whole file
+ *
+ * view() exposes the contents as a std::string_view, so a multi-GB file can be
+ * scanned without reading it into a buffer first; the kernel pages it in as
+ * the scan advances. Pass MADV_RANDOM as @advice for files that are probed
+ * at scattered offsets (such as a saved index) rather than scanned.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path, int advice = MADV_SEQUENTIAL) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("Cannot open " + path);
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat " + path);
+        }
+        size_ = (size_t)st.st_size;
+        if (size_ > 0) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map " + path);
+            }
+            data_ = static_cast<const char*>(p);
+            ::madvise(p, size_, advice);
+        }
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view view() const { return std::string_view(data_, size_); }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+#endif
+
+#endif // SUBSTRING_SEARCH_H
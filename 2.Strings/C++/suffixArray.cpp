@@ -0,0 +1,224 @@
+/**
+ * Suffix Array (Repeated-Substring Queries)
+ *
+ * This program indexes a text once with a suffix array and an LCP array
+ * (suffixArray.h) and then answers, without rescanning the text:
+ * 1. Substring search - every occurrence of a pattern, by binary search over the sorted suffixes
+ * 2. Longest repeated substring - the largest LCP between neighbouring suffixes
+ * 3. Distinct substrings - n(n+1)/2 minus the sum of the LCP array
+ *
+ * The suffix array is built with SA-IS and the LCP array with Kasai's algorithm;
+ * buildSuffixArrayNaive sorts the suffixes with std::sort for comparison. The
+ * index can be saved to a file and memory-mapped on the next run instead of
+ * being rebuilt.
+ *
+ * Time Complexity:
+ * - Build: O(n) for SA-IS and Kasai, O(n² log n) worst case for buildSuffixArrayNaive
+ * - Substring search: O(m log n) per pattern, plus the number of occurrences for findAll
+ * - Longest repeated substring and distinct substrings: O(n) over the LCP array
+ *
+ * Space Complexity: O(n) (9 bytes per text byte for the saved index)
+ *
+ * Input: The string "mississippi"
+ * Output: Its suffix and LCP arrays and the answers to the queries above
+ *
+ * Benchmark: ./suffixArray --bench [MB]
+ * Index a file: ./suffixArray --index <text-file> <index-file>
+ * Query a saved index: ./suffixArray --query <index-file> <pattern>...
+ */
+
+#include <iostream>  // For input/output operations
+#include <string>    // For string operations
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "substringSearch.h"
+#include "suffixArray.h"
+
+/**
+ * buildSuffixArrayNaive - Sort the suffixes of @text by comparing them directly
+ *
+ * Each comparison can take O(n) on repetitive text, so this is only usable
+ * for small inputs; it serves as the reference for buildSuffixArray.
+ *
+ * Returns: The starting positions of the suffixes in sorted order
+ */
+std::vector<uint32_t> buildSuffixArrayNaive(const std::string& text) {
+    std::vector<uint32_t> sa(text.size());
+    for (size_t i = 0; i < sa.size(); i++) sa[i] = (uint32_t)i;
+    std::string_view view(text);
+    std::sort(sa.begin(), sa.end(), [&](uint32_t a, uint32_t b) { return view.substr(a) < view.substr(b); });
+    return sa;
+}
+
+/**
+ * distinctSubstringsNaive - Count distinct substrings by inserting every one into a set
+ *
+ * Returns: The number of distinct non-empty substrings (O(n³) time, small inputs only)
+ */
+uint64_t distinctSubstringsNaive(const std::string& text) {
+    std::unordered_set<std::string_view> seen;
+    std::string_view view(text);
+    for (size_t i = 0; i < text.size(); i++) {
+        for (size_t len = 1; i + len <= text.size(); len++) seen.insert(view.substr(i, len));
+    }
+    return seen.size();
+}
+
+/**
+ * makeWordText - Roughly @bytes of space-separated words from a small vocabulary
+ *
+ * Natural-looking text with plenty of repeated phrases, so the LCP values
+ * (and the work SA-IS saves over plain sorting) are realistic.
+ */
+std::string makeWordText(size_t bytes, std::mt19937& rng) {
+    static const char* words[] = {"the", "of", "and", "suffix", "array", "index", "query", "text", "search",
+                                  "repeated", "substring", "pattern", "memory", "mapped", "file", "order"};
+    std::string text;
+    text.reserve(bytes + 16);
+    while (text.size() < bytes) {
+        text += words[rng() % 16];
+        text += rng() % 12 == 0 ? ".\n" : " ";
+    }
+    text.resize(bytes);
+    return text;
+}
+
+/**
+ * benchmarkSuffixArray - Build time, queries against rescanning, and save/load
+ * @megabytes: Size of the synthetic text
+ */
+void benchmarkSuffixArray(size_t megabytes) {
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::mt19937 rng(23);
+    std::cout << std::fixed << std::setprecision(2);
+    
+    // Build: SA-IS against sorting the suffixes, on inputs small enough to sort
+    std::cout << "       n   SA-IS ms   Kasai ms   std::sort ms" << std::endl;
+    for (size_t n = 1 << 14; n <= (1u << 20); n <<= 2) {
+        std::string text = makeWordText(n, rng);
+        std::vector<uint32_t> sa, lcp, sorted;
+        double tSais = timeIt([&] { sa = buildSuffixArray(text); });
+        double tKasai = timeIt([&] { lcp = buildLcpArray(text, sa); });
+        double tSort = timeIt([&] { sorted = buildSuffixArrayNaive(text); });
+        std::cout << std::setw(8) << n << std::setw(11) << tSais * 1e3 << std::setw(11) << tKasai * 1e3
+                  << std::setw(15) << tSort * 1e3 << (sa == sorted ? "" : "  (MISMATCH)") << std::endl;
+    }
+    
+    std::string text = makeWordText(megabytes << 20, rng);
+    std::unique_ptr<SuffixIndex> index;
+    double tBuild = timeIt([&] { index = std::make_unique<SuffixIndex>(text); });
+    std::cout << "\nIndex of " << megabytes << " MB built in " << tBuild * 1e3 << " ms" << std::endl;
+    
+    // Patterns: slices of the text (present) and slices with one byte changed (mostly absent)
+    std::vector<std::string> patterns;
+    for (int k = 0; k < 200; k++) {
+        size_t len = 6 + rng() % 24;
+        std::string p = text.substr(rng() % (text.size() - len), len);
+        if (k % 2) p[rng() % len] = 'z';
+        patterns.push_back(p);
+    }
+    
+    std::vector<size_t> viaScan(patterns.size()), viaIndex(patterns.size());
+    double tScan = timeIt([&] {
+        for (size_t k = 0; k < patterns.size(); k++) {
+            viaScan[k] = SubstringSearcher(patterns[k]).forEachMatch(text, [](size_t) {});
+        }
+    });
+    double tIndex = timeIt([&] {
+        for (size_t k = 0; k < patterns.size(); k++) viaIndex[k] = index->count(patterns[k]);
+    });
+    std::cout << patterns.size() << " pattern counts: rescanning " << tScan * 1e3 << " ms, index "
+              << tIndex * 1e3 << " ms" << (viaScan == viaIndex ? "" : "  (MISMATCH)") << std::endl;
+    
+    std::string_view repeated;
+    uint64_t distinct = 0;
+    double tRepeated = timeIt([&] { repeated = index->longestRepeatedSubstring(); });
+    double tDistinct = timeIt([&] { distinct = index->distinctSubstrings(); });
+    std::cout << "Longest repeated substring: " << repeated.size() << " bytes (" << tRepeated * 1e3 << " ms)"
+              << std::endl;
+    std::cout << "Distinct substrings: " << distinct << " (" << tDistinct * 1e3 << " ms)" << std::endl;
+    
+    // Save, then reopen the file the way a later run would
+    std::string path = "suffixArray.bench.idx";
+    double tSave = timeIt([&] { index->save(path); });
+    std::unique_ptr<SuffixIndex> loaded;
+    double tLoad = timeIt([&] { loaded = std::make_unique<SuffixIndex>(SuffixIndex::load(path)); });
+    std::vector<size_t> viaLoaded(patterns.size());
+    double tLoadedQueries = timeIt([&] {
+        for (size_t k = 0; k < patterns.size(); k++) viaLoaded[k] = loaded->count(patterns[k]);
+    });
+    std::cout << "Save " << tSave * 1e3 << " ms, load " << tLoad * 1e3 << " ms"
+              << (loaded->mapped() ? " (memory-mapped)" : "") << ", first queries after load "
+              << tLoadedQueries * 1e3 << " ms" << (viaLoaded == viaIndex ? "" : "  (MISMATCH)") << std::endl;
+    loaded.reset();
+    std::remove(path.c_str());
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkSuffixArray(argc > 2 ? std::stoul(argv[2]) : 16);
+        return 0;
+    }
+    if (argc > 3 && std::string(argv[1]) == "--index") {
+        try {
+            std::ifstream in(argv[2], std::ios::binary);
+            if (!in) throw std::runtime_error(std::string("Cannot open ") + argv[2]);
+            std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            SuffixIndex(text).save(argv[3]);
+            std::cerr << "Indexed " << text.size() << " bytes" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (argc > 3 && std::string(argv[1]) == "--query") {
+        try {
+            SuffixIndex index = SuffixIndex::load(argv[2]);
+            for (int k = 3; k < argc; k++) {
+                std::cout << argv[k] << ": " << index.count(argv[k]) << " occurrences, first at "
+                          << (long long)index.find(argv[k]) << std::endl;
+            }
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    
+    // Test string
+    std::string text = "mississippi";
+    SuffixIndex index(text);
+    std::cout << "Text: " << text << std::endl;
+    
+    // Display the sorted suffixes with their LCP values
+    std::cout << "\nrank  sa  lcp  suffix" << std::endl;
+    for (size_t r = 0; r < index.size(); r++) {
+        std::cout << std::setw(4) << r << std::setw(4) << index.suffix(r) << std::setw(5) << index.lcp(r) << "  "
+                  << text.substr(index.suffix(r)) << std::endl;
+    }
+    
+    // Queries answered from the index
+    std::cout << "\n\"issi\" found at:";
+    for (size_t pos : index.findAll("issi")) std::cout << " " << pos;
+    std::cout << std::endl;
+    std::cout << "\"ss\" occurs " << index.count("ss") << " times" << std::endl;
+    std::cout << "Longest repeated substring: " << index.longestRepeatedSubstring() << std::endl;
+    std::cout << "Distinct substrings: " << index.distinctSubstrings() << " (by brute force: "
+              << distinctSubstringsNaive(text) << ")" << std::endl;
+    
+    return 0;
+}
@@ -0,0 +1,433 @@
+/**
+ * Suffix Array and LCP Index
+ *
+ * The suffix array of a text lists the starting positions of all its
+ * suffixes in lexicographic order, and the LCP array holds the length of
+ * the longest common prefix of every pair of neighbouring suffixes. Built
+ * once, the two arrays answer substring queries without rescanning the text:
+ *
+ * - every occurrence of a pattern is one contiguous range of the suffix
+ *   array, found by binary search in O(m log n)
+ * - the longest repeated substring is the largest LCP entry
+ * - the number of distinct substrings is n(n+1)/2 minus the sum of the LCPs
+ *
+ * buildSuffixArray uses SA-IS (induced sorting): suffixes are classified as
+ * S-type (smaller than the next suffix) or L-type, the leftmost S-type
+ * positions (LMS) are sorted by recursing on a string of their names, and
+ * every other suffix is then placed by two linear scans over the buckets.
+ * buildLcpArray is Kasai's algorithm, which walks the suffixes in text order
+ * so the common prefix shrinks by at most one per step.
+ *
+ * SuffixIndex keeps the text and both arrays together. save() writes them to
+ * one file and load() memory-maps that file, so a large index is ready on the
+ * next start without being rebuilt or even read in.
+ *
+ *     SuffixIndex index(text);
+ *     index.save("text.sa");
+ *     ...
+ *     SuffixIndex loaded = SuffixIndex::load("text.sa");
+ *     size_t hits = loaded.count("needle");
+ *
+ * Time Complexity: O(n) to build, O(m log n) per pattern range
+ * Space Complexity: 9n bytes for the index (text, 32-bit suffix and LCP
+ *                   arrays), about 4n more while building
+ */
+
+#ifndef SUFFIX_ARRAY_H
+#define SUFFIX_ARRAY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "substringSearch.h" // MappedFile
+
+// Texts up to this many bytes can be indexed (positions are stored in 32 bits)
+constexpr size_t SUFFIX_ARRAY_MAX_TEXT = INT32_MAX - 1;
+
+namespace suffix_detail {
+
+// Below this length a comparison sort is faster than induced sorting
+constexpr int32_t NAIVE_SORT_LIMIT = 16;
+
+template <typename T>
+inline void naiveSort(const T* s, int32_t n, std::vector<int32_t>& sa) {
+    for (int32_t i = 0; i < n; i++) sa[i] = i;
+    std::sort(sa.begin(), sa.end(), [&](int32_t a, int32_t b) {
+        return std::lexicographical_compare(s + a, s + n, s + b, s + n);
+    });
+}
+
+/**
+ * induceSort - Place all suffixes, given the LMS suffixes in sorted order
+ * @bucketS: Start of the S-type part of each character's bucket
+ * @bucketL: Start of each character's bucket (L-type suffixes come first)
+ *
+ * The LMS suffixes go in first; a left-to-right scan then places every
+ * L-type suffix after the suffix that follows it, and a right-to-left scan
+ * places every S-type suffix from the ends of the buckets.
+ */
+template <typename T>
+inline void induceSort(const T* s, int32_t n, const std::vector<uint8_t>& isS, const std::vector<int32_t>& bucketS,
+                       const std::vector<int32_t>& bucketL, const std::vector<int32_t>& lms, std::vector<int32_t>& sa) {
+    std::fill(sa.begin(), sa.end(), -1);
+    std::vector<int32_t> next(bucketS);
+    for (int32_t p : lms) sa[next[s[p]]++] = p;
+
+    next = bucketL;
+    sa[next[s[n - 1]]++] = n - 1; // The last suffix is L-type (the virtual sentinel is smaller)
+    for (int32_t i = 0; i < n; i++) {
+        int32_t p = sa[i];
+        if (p >= 1 && !isS[p - 1]) sa[next[s[p - 1]]++] = p - 1;
+    }
+
+    // bucketL[c + 1] is the end of bucket c; S-type characters are never the largest one
+    next = bucketL;
+    for (int32_t i = n - 1; i >= 0; i--) {
+        int32_t p = sa[i];
+        if (p >= 1 && isS[p - 1]) sa[--next[s[p - 1] + 1]] = p - 1;
+    }
+}
+
+/**
+ * sais - Suffix array of s[0..n) over the alphabet [0, upper]
+ */
+template <typename T>
+inline std::vector<int32_t> sais(const T* s, int32_t n, int32_t upper) {
+    std::vector<int32_t> sa(n);
+    if (n <= NAIVE_SORT_LIMIT) {
+        naiveSort(s, n, sa);
+        return sa;
+    }
+
+    std::vector<uint8_t> isS(n, 0);
+    for (int32_t i = n - 2; i >= 0; i--) {
+        isS[i] = s[i] == s[i + 1] ? isS[i + 1] : s[i] < s[i + 1];
+    }
+
+    std::vector<int32_t> bucketL(upper + 1, 0), bucketS(upper + 1, 0);
+    for (int32_t i = 0; i < n; i++) {
+        if (!isS[i]) bucketS[s[i]]++;
+        else bucketL[s[i] + 1]++;
+    }
+    for (int32_t c = 0; c <= upper; c++) {
+        bucketS[c] += bucketL[c];
+        if (c < upper) bucketL[c + 1] += bucketS[c];
+    }
+
+    // LMS positions (an S-type suffix right after an L-type one), numbered in text order
+    std::vector<int32_t> lms, lmsIndex(n, -1);
+    for (int32_t i = 1; i < n; i++) {
+        if (!isS[i - 1] && isS[i]) {
+            lmsIndex[i] = (int32_t)lms.size();
+            lms.push_back(i);
+        }
+    }
+    int32_t m = (int32_t)lms.size();
+
+    // Sort the LMS substrings by one induced pass, then name them: equal
+    // substrings get equal names, so the names keep the order of the suffixes
+    induceSort(s, n, isS, bucketS, bucketL, lms, sa);
+    if (m == 0) return sa;
+
+    std::vector<int32_t> sorted;
+    sorted.reserve(m);
+    for (int32_t p : sa) {
+        if (p >= 0 && lmsIndex[p] >= 0) sorted.push_back(p);
+    }
+    std::vector<int32_t> names(m);
+    int32_t name = 0;
+    names[lmsIndex[sorted[0]]] = 0;
+    for (int32_t k = 1; k < m; k++) {
+        int32_t a = sorted[k - 1], b = sorted[k];
+        int32_t endA = lmsIndex[a] + 1 < m ? lms[lmsIndex[a] + 1] : n;
+        int32_t endB = lmsIndex[b] + 1 < m ? lms[lmsIndex[b] + 1] : n;
+        bool same = endA - a == endB - b;
+        if (same) {
+            while (a < endA && s[a] == s[b]) {
+                a++;
+                b++;
+            }
+            same = a < n && b < n && s[a] == s[b];
+        }
+        if (!same) name++;
+        names[lmsIndex[sorted[k]]] = name;
+    }
+
+    // Names all distinct: the LMS order is already exact; otherwise recurse
+    if (name + 1 < m) {
+        std::vector<int32_t> reduced = sais(names.data(), m, name);
+        for (int32_t k = 0; k < m; k++) sorted[k] = lms[reduced[k]];
+    }
+    induceSort(s, n, isS, bucketS, bucketL, sorted, sa);
+    return sa;
+}
+
+} // namespace suffix_detail
+
+/**
+ * buildSuffixArray - Starting positions of the suffixes of text in sorted order (SA-IS)
+ * @text: Up to SUFFIX_ARRAY_MAX_TEXT bytes, compared as unsigned
+ */
+inline std::vector<uint32_t> buildSuffixArray(std::string_view text) {
+    if (text.size() > SUFFIX_ARRAY_MAX_TEXT) throw std::length_error("Text too long for a 32-bit suffix array");
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(text.data());
+    std::vector<int32_t> sa = suffix_detail::sais(s, (int32_t)text.size(), 255);
+    return std::vector<uint32_t>(sa.begin(), sa.end());
+}
+
+/**
+ * buildLcpArray - Kasai's LCP array for a suffix array of text
+ *
+ * Returns: lcp[r] = length of the common prefix of suffixes sa[r - 1] and sa[r]; lcp[0] = 0
+ */
+inline std::vector<uint32_t> buildLcpArray(std::string_view text, const std::vector<uint32_t>& sa) {
+    size_t n = text.size();
+    std::vector<uint32_t> rank(n), lcp(n, 0);
+    for (size_t r = 0; r < n; r++) rank[sa[r]] = (uint32_t)r;
+
+    size_t h = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (rank[i] == 0) {
+            h = 0;
+            continue;
+        }
+        size_t j = sa[rank[i] - 1];
+        while (i + h < n && j + h < n && text[i + h] == text[j + h]) h++;
+        lcp[rank[i]] = (uint32_t)h;
+        if (h > 0) h--;
+    }
+    return lcp;
+}
+
+/**
+ * SuffixIndex - A text with its suffix array and LCP array
+ *
+ * An index is either built in memory or loaded from a file written by
+ * save(); a loaded index reads straight from the memory-mapped file.
+ * Moving is cheap; copying is disabled.
+ */
+class SuffixIndex {
+public:
+    explicit SuffixIndex(std::string_view text) : textStore_(text.begin(), text.end()) {
+        saStore_ = buildSuffixArray(text);
+        lcpStore_ = buildLcpArray(text, saStore_);
+        attach(textStore_.data(), saStore_.data(), lcpStore_.data(), text.size());
+    }
+
+    SuffixIndex(SuffixIndex&&) = default;
+    SuffixIndex& operator=(SuffixIndex&&) = default;
+    SuffixIndex(const SuffixIndex&) = delete;
+    SuffixIndex& operator=(const SuffixIndex&) = delete;
+
+    size_t size() const { return n_; }
+    std::string_view text() const { return std::string_view(text_, n_); }
+    uint32_t suffix(size_t rank) const { return sa_[rank]; }
+    uint32_t lcp(size_t rank) const { return lcp_[rank]; }
+    bool mapped() const { return mapped_; }
+
+    /**
+     * equalRange - Suffix-array ranks [first, second) of the suffixes starting with pattern
+     *
+     * An empty pattern is a prefix of every suffix, so its range is [0, n).
+     */
+    std::pair<size_t, size_t> equalRange(std::string_view pattern) const {
+        return {bound(pattern, false), bound(pattern, true)};
+    }
+
+    size_t count(std::string_view pattern) const {
+        auto [first, last] = equalRange(pattern);
+        return last - first;
+    }
+
+    /**
+     * find - Leftmost occurrence of pattern, or std::string::npos
+     *
+     * The occurrences are not in text order within their range, so this
+     * takes the minimum over them: O(m log n + occurrences).
+     */
+    size_t find(std::string_view pattern) const {
+        if (pattern.empty()) return 0;
+        auto [first, last] = equalRange(pattern);
+        size_t best = std::string::npos;
+        for (size_t r = first; r < last; r++) best = std::min<size_t>(best, sa_[r]);
+        return best;
+    }
+
+    /**
+     * findAll - Every occurrence of pattern (overlapping), in increasing order
+     */
+    std::vector<size_t> findAll(std::string_view pattern) const {
+        auto [first, last] = equalRange(pattern);
+        std::vector<size_t> positions(sa_ + first, sa_ + last);
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    /**
+     * longestRepeatedSubstring - Longest substring that occurs at least twice
+     *
+     * Returns: A view into text() (empty if no byte repeats); the one that
+     *          sorts first if several have the same length
+     */
+    std::string_view longestRepeatedSubstring() const {
+        size_t best = 0;
+        for (size_t r = 1; r < n_; r++) {
+            if (lcp_[r] > lcp_[best]) best = r;
+        }
+        return n_ == 0 ? std::string_view() : std::string_view(text_ + sa_[best], lcp_[best]);
+    }
+
+    /**
+     * distinctSubstrings - Number of distinct non-empty substrings
+     *
+     * Each suffix contributes its prefixes that are not also prefixes of the
+     * suffix before it in sorted order: n - sa[r] - lcp[r] of them.
+     */
+    uint64_t distinctSubstrings() const {
+        uint64_t total = (uint64_t)n_ * (n_ + 1) / 2;
+        for (size_t r = 0; r < n_; r++) total -= lcp_[r];
+        return total;
+    }
+
+    /**
+     * save - Write the index to path
+     *
+     * Layout: an 8-byte magic, the text length as uint64_t, the text padded
+     * to a multiple of 8 bytes, then the suffix and LCP arrays as uint32_t
+     * (each padded to a multiple of 8 bytes), all in native byte order.
+     */
+    void save(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("Cannot create " + path);
+        uint64_t n = n_;
+        out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+        out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        writePadded(out, text_, n_);
+        writePadded(out, reinterpret_cast<const char*>(sa_), n_ * sizeof(uint32_t));
+        writePadded(out, reinterpret_cast<const char*>(lcp_), n_ * sizeof(uint32_t));
+        if (!out.flush()) throw std::runtime_error("Cannot write " + path);
+    }
+
+    /**
+     * load - Open an index written by save()
+     *
+     * The file is memory-mapped where mmap is available (the text and arrays
+     * are used in place and paged in on demand) and read into memory
+     * otherwise. Throws std::runtime_error if it is not a valid index.
+     */
+    static SuffixIndex load(const std::string& path) {
+        SuffixIndex index;
+#if defined(__unix__) || defined(__APPLE__)
+        index.file_ = std::make_unique<MappedFile>(path, MADV_RANDOM);
+        index.mapped_ = true;
+        std::string_view bytes = index.file_->view();
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Cannot open " + path);
+        index.fileStore_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        std::string_view bytes(index.fileStore_.data(), index.fileStore_.size());
+#endif
+        uint64_t n = 0;
+        if (bytes.size() >= HEADER_SIZE) std::memcpy(&n, bytes.data() + sizeof(FILE_MAGIC), sizeof(n));
+        if (bytes.size() < HEADER_SIZE || std::memcmp(bytes.data(), FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+            n > SUFFIX_ARRAY_MAX_TEXT || bytes.size() != fileSize(n)) {
+            throw std::runtime_error(path + " is not a suffix index");
+        }
+
+        const char* text = bytes.data() + HEADER_SIZE;
+        const char* sa = text + padded(n);
+        const char* lcp = sa + padded(n * sizeof(uint32_t));
+        index.attach(text, reinterpret_cast<const uint32_t*>(sa), reinterpret_cast<const uint32_t*>(lcp), n);
+        return index;
+    }
+
+private:
+    static constexpr char FILE_MAGIC[8] = {'S', 'F', 'X', 'I', 'D', 'X', '0', '1'};
+    static constexpr size_t HEADER_SIZE = sizeof(FILE_MAGIC) + sizeof(uint64_t);
+
+    SuffixIndex() = default;
+
+    static size_t padded(size_t bytes) { return (bytes + 7) & ~size_t(7); }
+    static size_t fileSize(size_t n) { return HEADER_SIZE + padded(n) + 2 * padded(n * sizeof(uint32_t)); }
+
+    static void writePadded(std::ofstream& out, const char* data, size_t bytes) {
+        static const char zeros[8] = {};
+        out.write(data, bytes);
+        out.write(zeros, padded(bytes) - bytes);
+    }
+
+    void attach(const char* text, const uint32_t* sa, const uint32_t* lcp, size_t n) {
+        text_ = text;
+        sa_ = sa;
+        lcp_ = lcp;
+        n_ = n;
+    }
+
+    /**
+     * compareSuffix - Compare the suffix at pos with pattern
+     * @matched: Bytes already known to match; receives the common prefix length
+     *
+     * Returns: 0 if pattern is a prefix of the suffix, otherwise the sign of
+     *          (suffix - pattern)
+     */
+    int compareSuffix(size_t pos, std::string_view pattern, size_t& matched) const {
+        size_t k = matched, available = n_ - pos;
+        const char* suffix = text_ + pos;
+        while (k < pattern.size() && k < available && suffix[k] == pattern[k]) k++;
+        matched = k;
+        if (k == pattern.size()) return 0;
+        if (k == available) return -1;
+        return (unsigned char)suffix[k] < (unsigned char)pattern[k] ? -1 : 1;
+    }
+
+    /**
+     * bound - First rank whose suffix is not below pattern (upper: not a match or below)
+     *
+     * Every suffix between the two ends of the search range shares at least
+     * as many leading bytes with the pattern as both ends do, so comparisons
+     * resume from the smaller of the two known matches.
+     */
+    size_t bound(std::string_view pattern, bool upper) const {
+        size_t lo = 0, hi = n_, matchLo = 0, matchHi = 0;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            size_t matched = std::min(matchLo, matchHi);
+            int order = compareSuffix(sa_[mid], pattern, matched);
+            if (order < 0 || (upper && order == 0)) {
+                lo = mid + 1;
+                matchLo = matched;
+            } else {
+                hi = mid;
+                matchHi = matched;
+            }
+        }
+        return lo;
+    }
+
+    std::vector<char> textStore_;
+    std::vector<uint32_t> saStore_;
+    std::vector<uint32_t> lcpStore_;
+#if defined(__unix__) || defined(__APPLE__)
+    std::unique_ptr<MappedFile> file_;
+#else
+    std::vector<char> fileStore_;
+#endif
+    bool mapped_ = false;
+
+    const char* text_ = nullptr;
+    const uint32_t* sa_ = nullptr;
+    const uint32_t* lcp_ = nullptr;
+    size_t n_ = 0;
+};
+
+#endif // SUFFIX_ARRAY_H
@@ -0,0 +1,194 @@
+/**
+ * Contiguous Row-Major Matrix
+ *
+ * Shared matrix type for the 2D array programs in this directory.
+ *
+ * A std::vector<std::vector<int>> makes one heap allocation per row and the rows
+ * end up scattered across memory. Matrix<T> stores all rows in a single
+ * allocation, and MatrixView<T> is a non-owning window (rows, cols, stride)
+ * onto any rectangular block of it, so submatrices can be passed around
+ * without copying.
+ *
+ *     Matrix<int> m = {{1, 2, 3},
+ *                      {4, 5, 6}};
+ *     MatrixView<int> right = m.block(0, 1, 2, 2);   // {{2, 3}, {5, 6}}
+ *     right(1, 0) = 50;                              // writes m(1, 1)
+ *
+ * Element (i, j) of a view lives at data()[i * stride() + j].
+ */
+
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * MatrixView - Non-owning view of a row-major block of elements
+ *
+ * Use MatrixView<const T> for read-only access. A MatrixView<T> converts
+ * implicitly to a MatrixView<const T>.
+ */
+template <typename T>
+class MatrixView {
+public:
+    MatrixView() = default;
+    MatrixView(T* data, int rows, int cols, int stride)
+        : data_(data), rows_(rows), cols_(cols), stride_(stride) {}
+
+    // Allow MatrixView<int> -> MatrixView<const int>
+    template <typename U, typename = std::enable_if_t<std::is_same<const U, T>::value>>
+    MatrixView(const MatrixView<U>& other)
+        : data_(other.data()), rows_(other.rows()), cols_(other.cols()), stride_(other.stride()) {}
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int stride() const { return stride_; }
+    bool empty() const { return rows_ == 0 || cols_ == 0; }
+    bool isSquare() const { return rows_ == cols_; }
+    T* data() const { return data_; }
+
+    T& operator()(int i, int j) const { return data_[(size_t)i * stride_ + j]; }
+    T* row(int i) const { return data_ + (size_t)i * stride_; }
+
+    /**
+     * block - View of the h×w submatrix whose top-left corner is (r, c)
+     */
+    MatrixView block(int r, int c, int h, int w) const {
+        if (r < 0 || c < 0 || h < 0 || w < 0 || r + h > rows_ || c + w > cols_) {
+            throw std::out_of_range("Matrix block out of range");
+        }
+        return MatrixView(data_ + (size_t)r * stride_ + c, h, w, stride_);
+    }
+
+private:
+    T* data_ = nullptr;
+    int rows_ = 0;
+    int cols_ = 0;
+    int stride_ = 0;
+};
+
+/**
+ * Matrix - Owning row-major matrix backed by a single allocation
+ *
+ * The stride of a Matrix always equals its number of columns, so the whole
+ * matrix is one contiguous range of rows × cols elements.
+ */
+template <typename T>
+class Matrix {
+public:
+    Matrix() = default;
+    Matrix(int rows, int cols, const T& value = T())
+        : rows_(rows), cols_(cols), data_(checkedSize(rows, cols), value) {}
+
+    Matrix(std::initializer_list<std::initializer_list<T>> init)
+        : rows_((int)init.size()), cols_(init.size() ? (int)init.begin()->size() : 0) {
+        data_.reserve((size_t)rows_ * cols_);
+        for (const auto& r : init) {
+            if ((int)r.size() != cols_) {
+                throw std::invalid_argument("All rows of a matrix must have the same length");
+            }
+            data_.insert(data_.end(), r.begin(), r.end());
+        }
+    }
+
+    /**
+     * fromVectors - Copy a vector-of-vectors matrix into contiguous storage
+     * @rows: The input matrix; every row must have the same length
+     */
+    static Matrix fromVectors(const std::vector<std::vector<T>>& rows) {
+        int r = (int)rows.size();
+        int c = r ? (int)rows[0].size() : 0;
+        Matrix m(r, c);
+        for (int i = 0; i < r; i++) {
+            if ((int)rows[i].size() != c) {
+                throw std::invalid_argument("All rows of a matrix must have the same length");
+            }
+            std::copy(rows[i].begin(), rows[i].end(), m.row(i));
+        }
+        return m;
+    }
+
+    /**
+     * toVectors - Copy the matrix back into a vector-of-vectors
+     */
+    std::vector<std::vector<T>> toVectors() const {
+        std::vector<std::vector<T>> out(rows_);
+        for (int i = 0; i < rows_; i++) {
+            out[i].assign(row(i), row(i) + cols_);
+        }
+        return out;
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int stride() const { return cols_; }
+    bool empty() const { return rows_ == 0 || cols_ == 0; }
+    bool isSquare() const { return rows_ == cols_; }
+    size_t size() const { return data_.size(); }
+    T* data() { return data_.data(); }
+    const T* data() const { return data_.data(); }
+
+    T& operator()(int i, int j) { return data_[(size_t)i * cols_ + j]; }
+    const T& operator()(int i, int j) const { return data_[(size_t)i * cols_ + j]; }
+    T* row(int i) { return data_.data() + (size_t)i * cols_; }
+    const T* row(int i) const { return data_.data() + (size_t)i * cols_; }
+
+    /**
+     * reshape - Reinterpret the same elements with new dimensions
+     * @rows: New number of rows
+     * @cols: New number of columns; rows × cols must equal size()
+     */
+    void reshape(int rows, int cols) {
+        if (rows < 0 || cols < 0 || (size_t)rows * cols != data_.size()) {
+            throw std::invalid_argument("Reshape must preserve the number of elements");
+        }
+        rows_ = rows;
+        cols_ = cols;
+    }
+
+    MatrixView<T> view() { return MatrixView<T>(data(), rows_, cols_, cols_); }
+    MatrixView<const T> view() const { return MatrixView<const T>(data(), rows_, cols_, cols_); }
+    operator MatrixView<T>() { return view(); }
+    operator MatrixView<const T>() const { return view(); }
+
+    MatrixView<T> block(int r, int c, int h, int w) { return view().block(r, c, h, w); }
+    MatrixView<const T> block(int r, int c, int h, int w) const { return view().block(r, c, h, w); }
+
+    bool operator==(const Matrix& other) const {
+        return rows_ == other.rows_ && cols_ == other.cols_ && data_ == other.data_;
+    }
+    bool operator!=(const Matrix& other) const { return !(*this == other); }
+
+private:
+    // Runs in the initialiser list, before data_ would be sized from a
+    // negative product
+    static size_t checkedSize(int rows, int cols) {
+        if (rows < 0 || cols < 0) {
+            throw std::invalid_argument("Matrix dimensions cannot be negative");
+        }
+        return (size_t)rows * cols;
+    }
+
+    int rows_ = 0;
+    int cols_ = 0;
+    std::vector<T> data_;
+};
+
+/**
+ * copyMatrix - Copy a view into a new owning matrix
+ */
+template <typename T>
+Matrix<std::remove_const_t<T>> copyMatrix(MatrixView<T> src) {
+    Matrix<std::remove_const_t<T>> m(src.rows(), src.cols());
+    for (int i = 0; i < src.rows(); i++) {
+        std::copy(src.row(i), src.row(i) + src.cols(), m.row(i));
+    }
+    return m;
+}
+
+#endif // MATRIX_H
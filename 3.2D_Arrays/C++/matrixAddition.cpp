@@ -3,12 +3,22 @@
  * 
  * This program demonstrates how to add two matrices in C++.
  * 
+ * For contiguous matrices, +, -, scalar * and hadamard() build expression
+ * templates that are fused into one pass when evaluated (see below).
+ * Benchmark: ./matrixAddition --bench [n]
+ * 
  * Time Complexity: O(m×n) where m and n are the dimensions of the matrices
  * Space Complexity: O(m×n) for storing the result matrix
  */
 
 #include <iostream>
 #include <vector>
+#include <stdexcept>
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "matrix.h"
 
 /**
  * addMatrices - Add two matrices and return the result
@@ -43,6 +53,294 @@ std::vector<std::vector<int>> addMatrices(const std::vector<std::vector<int>>& m
     return result;
 }
 
+/**
+ * addMatrices - Add two contiguous matrices (or matrix views)
+ * @matrix1: The first input matrix
+ * @matrix2: The second input matrix
+ * 
+ * Same as above, but both inputs and the result are single-allocation
+ * row-major matrices, so each row is added with one unit-stride loop.
+ * 
+ * Returns: A new matrix containing the sum of the input matrices
+ */
+Matrix<int> addMatrices(MatrixView<const int> matrix1, MatrixView<const int> matrix2) {
+    if (matrix1.rows() != matrix2.rows() || matrix1.cols() != matrix2.cols()) {
+        throw std::invalid_argument("Matrices must have the same dimensions for addition");
+    }
+    
+    Matrix<int> result(matrix1.rows(), matrix1.cols());
+    
+    for (int i = 0; i < matrix1.rows(); i++) {
+        const int* a = matrix1.row(i);
+        const int* b = matrix2.row(i);
+        int* out = result.row(i);
+        for (int j = 0; j < matrix1.cols(); j++) {
+            out[j] = a[j] + b[j];
+        }
+    }
+    
+    return result;
+}
+
+/*
+ * Expression templates
+ * 
+ * addMatrices allocates a new matrix per call, so A + B + C built from it makes
+ * a temporary for A + B and walks memory three times. With the operators below,
+ * A + B + C only builds a small tree of nodes that refer to the operands; the
+ * arithmetic happens once per element when the tree is evaluated into a
+ * destination, in a single row-by-row pass the compiler can vectorise.
+ * 
+ *     Matrix<int> result = evaluate(A + B - 2 * C);
+ *     assign(out, hadamard(A, B) + map(C, [](int x) { return x * x; }));
+ */
+
+/**
+ * MatrixExpr - CRTP base marking a type as a matrix expression
+ * 
+ * Every expression provides rows(), cols() and rowAccess(i), which returns a
+ * cheap object whose operator[](j) yields element (i, j).
+ */
+template <typename E>
+struct MatrixExpr {
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+/**
+ * LeafExpr - An existing matrix (or view) used as an operand
+ */
+template <typename T>
+class LeafExpr : public MatrixExpr<LeafExpr<T>> {
+public:
+    using value_type = T;
+    
+    explicit LeafExpr(MatrixView<const T> view) : view_(view) {}
+    
+    int rows() const { return view_.rows(); }
+    int cols() const { return view_.cols(); }
+    const T* rowAccess(int i) const { return view_.row(i); }
+    
+private:
+    MatrixView<const T> view_;
+};
+
+/**
+ * BinaryExpr - Element-wise combination op(left(i, j), right(i, j))
+ */
+template <typename L, typename R, typename Op>
+class BinaryExpr : public MatrixExpr<BinaryExpr<L, R, Op>> {
+public:
+    using value_type = decltype(std::declval<Op>()(std::declval<typename L::value_type>(),
+                                                   std::declval<typename R::value_type>()));
+    
+    BinaryExpr(const L& left, const R& right, Op op) : left_(left), right_(right), op_(op) {
+        if (left.rows() != right.rows() || left.cols() != right.cols()) {
+            throw std::invalid_argument("Matrices must have the same dimensions for element-wise operations");
+        }
+    }
+    
+    int rows() const { return left_.rows(); }
+    int cols() const { return left_.cols(); }
+    
+    auto rowAccess(int i) const {
+        struct Row {
+            decltype(std::declval<const L&>().rowAccess(0)) left;
+            decltype(std::declval<const R&>().rowAccess(0)) right;
+            Op op;
+            value_type operator[](int j) const { return op(left[j], right[j]); }
+        };
+        return Row{left_.rowAccess(i), right_.rowAccess(i), op_};
+    }
+    
+private:
+    L left_;
+    R right_;
+    Op op_;
+};
+
+/**
+ * UnaryExpr - Element-wise op(inner(i, j)); also used for scaling
+ */
+template <typename E, typename Op>
+class UnaryExpr : public MatrixExpr<UnaryExpr<E, Op>> {
+public:
+    using value_type = decltype(std::declval<Op>()(std::declval<typename E::value_type>()));
+    
+    UnaryExpr(const E& inner, Op op) : inner_(inner), op_(op) {}
+    
+    int rows() const { return inner_.rows(); }
+    int cols() const { return inner_.cols(); }
+    
+    auto rowAccess(int i) const {
+        struct Row {
+            decltype(std::declval<const E&>().rowAccess(0)) inner;
+            Op op;
+            value_type operator[](int j) const { return op(inner[j]); }
+        };
+        return Row{inner_.rowAccess(i), op_};
+    }
+    
+private:
+    E inner_;
+    Op op_;
+};
+
+// asExpr - Turn a Matrix, a MatrixView or an expression into an expression node
+template <typename T>
+LeafExpr<T> asExpr(const Matrix<T>& m) { return LeafExpr<T>(m.view()); }
+template <typename T>
+LeafExpr<std::remove_const_t<T>> asExpr(MatrixView<T> v) { return LeafExpr<std::remove_const_t<T>>(v); }
+template <typename E>
+const E& asExpr(const MatrixExpr<E>& e) { return e.self(); }
+
+// Operands accepted by the operators: matrices, views and expressions
+template <typename X>
+struct IsMatrixOperand : std::false_type {};
+template <typename T>
+struct IsMatrixOperand<Matrix<T>> : std::true_type {};
+template <typename T>
+struct IsMatrixOperand<MatrixView<T>> : std::true_type {};
+template <typename L, typename R, typename Op>
+struct IsMatrixOperand<BinaryExpr<L, R, Op>> : std::true_type {};
+template <typename E, typename Op>
+struct IsMatrixOperand<UnaryExpr<E, Op>> : std::true_type {};
+template <typename T>
+struct IsMatrixOperand<LeafExpr<T>> : std::true_type {};
+
+template <typename A, typename B = A>
+using EnableIfOperands = std::enable_if_t<IsMatrixOperand<std::decay_t<A>>::value &&
+                                          IsMatrixOperand<std::decay_t<B>>::value>;
+
+// Element type of an operand
+template <typename A>
+using OperandValue = typename std::decay_t<decltype(asExpr(std::declval<const A&>()))>::value_type;
+
+/**
+ * zipWith - Element-wise binary operation on two operands
+ * @a, @b: Matrices, views or expressions of the same dimensions
+ * @op: Callable op(a(i, j), b(i, j))
+ */
+template <typename A, typename B, typename Op, typename = EnableIfOperands<A, B>>
+auto zipWith(const A& a, const B& b, Op op) {
+    auto l = asExpr(a);
+    auto r = asExpr(b);
+    return BinaryExpr<decltype(l), decltype(r), Op>(l, r, op);
+}
+
+/**
+ * map - Element-wise unary operation on an operand
+ * @a: Matrix, view or expression
+ * @op: Callable op(a(i, j))
+ */
+template <typename A, typename Op, typename = EnableIfOperands<A>>
+auto map(const A& a, Op op) {
+    auto e = asExpr(a);
+    return UnaryExpr<decltype(e), Op>(e, op);
+}
+
+template <typename A, typename B, typename = EnableIfOperands<A, B>>
+auto operator+(const A& a, const B& b) {
+    return zipWith(a, b, [](auto x, auto y) { return x + y; });
+}
+
+template <typename A, typename B, typename = EnableIfOperands<A, B>>
+auto operator-(const A& a, const B& b) {
+    return zipWith(a, b, [](auto x, auto y) { return x - y; });
+}
+
+template <typename A, typename = EnableIfOperands<A>>
+auto operator*(OperandValue<A> k, const A& a) {
+    return map(a, [k](auto x) { return k * x; });
+}
+
+template <typename A, typename = EnableIfOperands<A>>
+auto operator*(const A& a, OperandValue<A> k) {
+    return map(a, [k](auto x) { return x * k; });
+}
+
+/**
+ * hadamard - Element-wise product of two operands
+ */
+template <typename A, typename B, typename = EnableIfOperands<A, B>>
+auto hadamard(const A& a, const B& b) {
+    return zipWith(a, b, [](auto x, auto y) { return x * y; });
+}
+
+/**
+ * assign - Evaluate an expression into an existing matrix (or view)
+ * @dst: Destination with the same dimensions as @expr
+ * @expr: The expression to evaluate
+ * 
+ * This is the only place where elements are computed: one pass over the
+ * destination, one row at a time.
+ */
+template <typename T, typename E>
+void assign(MatrixView<T> dst, const MatrixExpr<E>& expr) {
+    const E& e = expr.self();
+    if (dst.rows() != e.rows() || dst.cols() != e.cols()) {
+        throw std::invalid_argument("Destination must have the same dimensions as the expression");
+    }
+    int cols = e.cols();
+    for (int i = 0; i < e.rows(); i++) {
+        auto src = e.rowAccess(i);
+        T* out = dst.row(i);
+        for (int j = 0; j < cols; j++) {
+            out[j] = src[j];
+        }
+    }
+}
+
+template <typename T, typename E>
+void assign(Matrix<T>& dst, const MatrixExpr<E>& expr) {
+    assign(dst.view(), expr);
+}
+
+/**
+ * evaluate - Evaluate an expression into a new matrix
+ * 
+ * Returns: A new matrix holding the value of @expr
+ */
+template <typename E>
+Matrix<typename E::value_type> evaluate(const MatrixExpr<E>& expr) {
+    Matrix<typename E::value_type> result(expr.self().rows(), expr.self().cols());
+    assign(result, expr);
+    return result;
+}
+
+/**
+ * benchmarkAddition - Compare chained addMatrices calls with a fused A + B + C
+ * @n: Dimension of the square matrices
+ */
+void benchmarkAddition(int n) {
+    Matrix<int> a(n, n), b(n, n), c(n, n), out(n, n);
+    for (size_t k = 0; k < a.size(); k++) {
+        a.data()[k] = (int)k;
+        b.data()[k] = (int)(k * 3);
+        c.data()[k] = (int)(k * 7);
+    }
+    std::vector<std::vector<int>> na = a.toVectors(), nb = b.toVectors(), nc = c.toVectors();
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::vector<std::vector<int>> nested;
+    Matrix<int> chained, fused;
+    double tNested = timeIt([&] { nested = addMatrices(addMatrices(na, nb), nc); });
+    double tChained = timeIt([&] { chained = addMatrices(addMatrices(a, b), c); });
+    double tFused = timeIt([&] { fused = evaluate(a + b + c); });
+    double tInto = timeIt([&] { assign(out, a + b + c); });
+    
+    bool ok = chained == fused && fused == out && Matrix<int>::fromVectors(nested) == fused;
+    std::cout << "n = " << n << (ok ? "" : "  (MISMATCH)") << std::endl;
+    std::cout << "  chained addMatrices (vector-of-vectors): " << tNested << " ms" << std::endl;
+    std::cout << "  chained addMatrices (Matrix<int>):       " << tChained << " ms" << std::endl;
+    std::cout << "  fused evaluate(A + B + C):               " << tFused << " ms" << std::endl;
+    std::cout << "  fused assign(out, A + B + C):            " << tInto << " ms" << std::endl;
+}
+
 /**
  * printMatrix - Print a matrix
  * @matrix: The matrix to print
@@ -58,7 +356,25 @@ void printMatrix(const std::vector<std::vector<int>>& matrix) {
     }
 }
 
-int main() {
+/**
+ * printMatrix - Print a contiguous matrix or matrix view
+ * @matrix: The matrix to print
+ */
+void printMatrix(MatrixView<const int> matrix) {
+    for (int i = 0; i < matrix.rows(); i++) {
+        for (int j = 0; j < matrix.cols(); j++) {
+            std::cout << matrix(i, j) << "\t";
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkAddition(argc > 2 ? std::stoi(argv[2]) : 4096);
+        return 0;
+    }
+    
     // Example matrices
     std::vector<std::vector<int>> matrix1 = {
         {1, 2, 3},
@@ -106,5 +422,18 @@ int main() {
         std::cerr << "Error: " << e.what() << std::endl;
     }
     
+    // Example with contiguous matrices and a submatrix view
+    std::cout << "\nExample with contiguous Matrix<int> storage:" << std::endl;
+    Matrix<int> flat1 = Matrix<int>::fromVectors(matrix1);
+    Matrix<int> flat2 = Matrix<int>::fromVectors(matrix2);
+    printMatrix(addMatrices(flat1, flat2));
+    
+    std::cout << "\nSum of the top-left 2x2 blocks:" << std::endl;
+    printMatrix(addMatrices(flat1.block(0, 0, 2, 2), flat2.block(0, 0, 2, 2)));
+    
+    // Example with a fused expression: one pass, no temporaries
+    std::cout << "\nFused expression 2 * (Matrix 1 + Matrix 2) - hadamard(Matrix 1, Matrix 1):" << std::endl;
+    printMatrix(evaluate(2 * (flat1 + flat2) - hadamard(flat1, flat1)));
+    
     return 0;
 }
\ No newline at end of file
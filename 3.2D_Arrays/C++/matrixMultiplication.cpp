@@ -3,6 +3,20 @@
  * 
  * This program demonstrates how to multiply two matrices in C++.
  * 
+ * Besides the textbook triple loop, it contains a cache-blocked GEMM engine:
+ * 1. B is packed into KC×NC panels of NR-wide column strips (fits in L2/L3)
+ * 2. A is packed into MC×KC blocks of MR-tall row strips (fits in L2)
+ * 3. An MR×NR register-blocked micro-kernel (AVX2 when compiled with -mavx2)
+ *    accumulates one tile of C while streaming through the packed panels
+ * 4. The rows of C are split across hardware threads
+ * 
+ * For large square products, multiplyStrassen applies Strassen–Winograd
+ * (7 half-size products per level) down to a crossover size, then gemmBlocked.
+ * 
+ * Build with: g++ -std=c++17 -O3 -march=native -pthread matrixMultiplication.cpp
+ * Benchmark:  ./matrixMultiplication --bench 2048
+ * Tune:       ./matrixMultiplication --tune-strassen 4096
+ * 
  * Time Complexity: O(n³) where n is the dimension of the matrices
  * Space Complexity: O(n²) for storing the result matrix
  */
@@ -10,9 +24,30 @@
 #include <iostream>
 #include <vector>
 #include <iomanip> // for std::setw
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <cstring>
+#include <string>
+#include "matrix.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Register tile of the micro-kernel (MR rows × NR columns of C)
+constexpr int GEMM_MR = 4;
+constexpr int GEMM_NR = 16;
+// Cache blocking: MC×KC block of A stays in L2, KC×NC panel of B in L3
+constexpr int GEMM_MC = 128;
+constexpr int GEMM_KC = 256;
+constexpr int GEMM_NC = 2048;
 
 /**
- * multiplyMatrices - Multiply two matrices and return the result
+ * multiplyMatricesNaive - Multiply two matrices with the i-j-k triple loop
  * @matrix1: The first input matrix
  * @matrix2: The second input matrix
  * 
@@ -20,9 +55,12 @@
  * For matrix multiplication to be valid, the number of columns in the first matrix
  * must equal the number of rows in the second matrix.
  * 
+ * The inner loop walks down a column of matrix2, so every iteration touches a
+ * different row. Kept as the reference implementation for the benchmark.
+ * 
  * Returns: A new matrix containing the product of the input matrices
  */
-std::vector<std::vector<int>> multiplyMatrices(const std::vector<std::vector<int>>& matrix1, 
+std::vector<std::vector<int>> multiplyMatricesNaive(const std::vector<std::vector<int>>& matrix1, 
                                               const std::vector<std::vector<int>>& matrix2) {
     // Check if matrices are empty
     if (matrix1.empty() || matrix2.empty()) {
@@ -53,6 +91,594 @@ std::vector<std::vector<int>> multiplyMatrices(const std::vector<std::vector<int
     return result;
 }
 
+/**
+ * packPanelB - Pack a KC×NC panel of B into NR-wide column strips
+ * @B: Pointer to the top-left element of the panel
+ * @ldb: Row stride of B
+ * @kc: Number of rows in the panel
+ * @nc: Number of columns in the panel
+ * @packed: Destination buffer of at least kc × roundUp(nc, NR) elements
+ * 
+ * Within each strip the NR values of a row are contiguous, so the micro-kernel
+ * reads B with unit stride. Columns past @nc are zero-padded.
+ */
+static void packPanelB(const int* B, int ldb, int kc, int nc, int* packed) {
+    for (int j = 0; j < nc; j += GEMM_NR) {
+        int nr = std::min(GEMM_NR, nc - j);
+        for (int p = 0; p < kc; p++) {
+            const int* src = B + (size_t)p * ldb + j;
+            for (int jj = 0; jj < nr; jj++) packed[jj] = src[jj];
+            for (int jj = nr; jj < GEMM_NR; jj++) packed[jj] = 0;
+            packed += GEMM_NR;
+        }
+    }
+}
+
+/**
+ * packBlockA - Pack an MC×KC block of A into MR-tall row strips
+ * @A: Pointer to the top-left element of the block
+ * @lda: Row stride of A
+ * @mc: Number of rows in the block
+ * @kc: Number of columns in the block
+ * @packed: Destination buffer of at least roundUp(mc, MR) × kc elements
+ * 
+ * Within each strip the MR values of a column are contiguous. Rows past @mc
+ * are zero-padded.
+ */
+static void packBlockA(const int* A, int lda, int mc, int kc, int* packed) {
+    for (int i = 0; i < mc; i += GEMM_MR) {
+        int mr = std::min(GEMM_MR, mc - i);
+        for (int p = 0; p < kc; p++) {
+            for (int ii = 0; ii < mr; ii++) packed[ii] = A[(size_t)(i + ii) * lda + p];
+            for (int ii = mr; ii < GEMM_MR; ii++) packed[ii] = 0;
+            packed += GEMM_MR;
+        }
+    }
+}
+
+/**
+ * microKernel - Compute C[MR×NR] += A_strip × B_strip
+ * @kc: Shared dimension of the two strips
+ * @a: Packed MR-tall strip of A
+ * @b: Packed NR-wide strip of B
+ * @C: Pointer to the top-left element of the output tile
+ * @ldc: Row stride of C
+ * 
+ * The whole MR×NR tile lives in registers for the duration of the loop.
+ */
+#if defined(__AVX2__)
+static void microKernel(int kc, const int* a, const int* b, int* C, int ldc) {
+    __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+    __m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+    __m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+    __m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+    
+    for (int p = 0; p < kc; p++) {
+        __m256i b0 = _mm256_loadu_si256((const __m256i*)b);
+        __m256i b1 = _mm256_loadu_si256((const __m256i*)(b + 8));
+        __m256i a0 = _mm256_set1_epi32(a[0]);
+        __m256i a1 = _mm256_set1_epi32(a[1]);
+        __m256i a2 = _mm256_set1_epi32(a[2]);
+        __m256i a3 = _mm256_set1_epi32(a[3]);
+        c00 = _mm256_add_epi32(c00, _mm256_mullo_epi32(a0, b0));
+        c01 = _mm256_add_epi32(c01, _mm256_mullo_epi32(a0, b1));
+        c10 = _mm256_add_epi32(c10, _mm256_mullo_epi32(a1, b0));
+        c11 = _mm256_add_epi32(c11, _mm256_mullo_epi32(a1, b1));
+        c20 = _mm256_add_epi32(c20, _mm256_mullo_epi32(a2, b0));
+        c21 = _mm256_add_epi32(c21, _mm256_mullo_epi32(a2, b1));
+        c30 = _mm256_add_epi32(c30, _mm256_mullo_epi32(a3, b0));
+        c31 = _mm256_add_epi32(c31, _mm256_mullo_epi32(a3, b1));
+        a += GEMM_MR;
+        b += GEMM_NR;
+    }
+    
+    __m256i acc[GEMM_MR][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}};
+    for (int r = 0; r < GEMM_MR; r++) {
+        __m256i* row = (__m256i*)(C + (size_t)r * ldc);
+        _mm256_storeu_si256(row, _mm256_add_epi32(_mm256_loadu_si256(row), acc[r][0]));
+        _mm256_storeu_si256(row + 1, _mm256_add_epi32(_mm256_loadu_si256(row + 1), acc[r][1]));
+    }
+}
+#else
+static void microKernel(int kc, const int* a, const int* b, int* C, int ldc) {
+    int acc[GEMM_MR][GEMM_NR] = {};
+    
+    for (int p = 0; p < kc; p++) {
+        for (int r = 0; r < GEMM_MR; r++) {
+            int av = a[r];
+            for (int c = 0; c < GEMM_NR; c++) {
+                acc[r][c] += av * b[c];
+            }
+        }
+        a += GEMM_MR;
+        b += GEMM_NR;
+    }
+    
+    for (int r = 0; r < GEMM_MR; r++) {
+        for (int c = 0; c < GEMM_NR; c++) {
+            C[(size_t)r * ldc + c] += acc[r][c];
+        }
+    }
+}
+#endif
+
+/**
+ * gemmBlockedRange - Single-threaded blocked GEMM over a range of rows of C
+ * @A, @B, @C: Row-major operands with row strides @lda, @ldb, @ldc
+ * @M: Number of rows of C to compute
+ * @N: Number of columns of C
+ * @K: Shared dimension
+ * 
+ * Accumulates A × B into C (C is not cleared here).
+ */
+static void gemmBlockedRange(const int* A, int lda, const int* B, int ldb, int* C, int ldc,
+                             int M, int N, int K) {
+    // Reused across calls so that many small products (e.g. Strassen leaves)
+    // do not allocate
+    thread_local std::vector<int> packedA((size_t)GEMM_MC * GEMM_KC);
+    thread_local std::vector<int> packedB((size_t)GEMM_KC * GEMM_NC);
+    int edge[GEMM_MR * GEMM_NR];
+    
+    for (int jc = 0; jc < N; jc += GEMM_NC) {
+        int nc = std::min(GEMM_NC, N - jc);
+        for (int pc = 0; pc < K; pc += GEMM_KC) {
+            int kc = std::min(GEMM_KC, K - pc);
+            packPanelB(B + (size_t)pc * ldb + jc, ldb, kc, nc, packedB.data());
+            
+            for (int ic = 0; ic < M; ic += GEMM_MC) {
+                int mc = std::min(GEMM_MC, M - ic);
+                packBlockA(A + (size_t)ic * lda + pc, lda, mc, kc, packedA.data());
+                
+                for (int jr = 0; jr < nc; jr += GEMM_NR) {
+                    int nr = std::min(GEMM_NR, nc - jr);
+                    const int* b = packedB.data() + (size_t)jr * kc;
+                    
+                    for (int ir = 0; ir < mc; ir += GEMM_MR) {
+                        int mr = std::min(GEMM_MR, mc - ir);
+                        const int* a = packedA.data() + (size_t)ir * kc;
+                        int* c = C + (size_t)(ic + ir) * ldc + jc + jr;
+                        
+                        if (mr == GEMM_MR && nr == GEMM_NR) {
+                            microKernel(kc, a, b, c, ldc);
+                        } else {
+                            // Partial tile on the matrix edge: compute into a scratch tile
+                            std::fill(edge, edge + GEMM_MR * GEMM_NR, 0);
+                            microKernel(kc, a, b, edge, GEMM_NR);
+                            for (int r = 0; r < mr; r++) {
+                                for (int q = 0; q < nr; q++) {
+                                    c[(size_t)r * ldc + q] += edge[r * GEMM_NR + q];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * gemmBlocked - Cache-blocked, multithreaded matrix multiplication C = A × B
+ * @A: Row-major M×K matrix with row stride @lda
+ * @B: Row-major K×N matrix with row stride @ldb
+ * @C: Row-major M×N output matrix with row stride @ldc (overwritten)
+ * @M, @N, @K: Matrix dimensions
+ * @numThreads: Number of worker threads (0 = one per hardware thread)
+ * @accumulate: Compute C += A × B instead of overwriting C
+ * 
+ * The rows of C are split into contiguous, MR-aligned slices, one per thread.
+ * Each thread packs its own copy of the B panels, so no synchronisation is
+ * needed between threads.
+ */
+void gemmBlocked(const int* A, int lda, const int* B, int ldb, int* C, int ldc,
+                 int M, int N, int K, unsigned numThreads = 0, bool accumulate = false) {
+    if (M <= 0 || N <= 0) return;
+    if (!accumulate) {
+        for (int i = 0; i < M; i++) {
+            std::fill(C + (size_t)i * ldc, C + (size_t)i * ldc + N, 0);
+        }
+    }
+    if (K <= 0) return;
+    
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // Give every thread at least one full MC block of rows
+    unsigned maxUseful = (unsigned)((M + GEMM_MC - 1) / GEMM_MC);
+    numThreads = std::min(numThreads, maxUseful);
+    
+    if (numThreads <= 1) {
+        gemmBlockedRange(A, lda, B, ldb, C, ldc, M, N, K);
+        return;
+    }
+    
+    int rowsPerThread = (M + numThreads - 1) / numThreads;
+    rowsPerThread = (rowsPerThread + GEMM_MR - 1) / GEMM_MR * GEMM_MR;
+    
+    std::vector<std::thread> workers;
+    for (int start = 0; start < M; start += rowsPerThread) {
+        int rows = std::min(rowsPerThread, M - start);
+        workers.emplace_back(gemmBlockedRange, A + (size_t)start * lda, lda, B, ldb,
+                             C + (size_t)start * ldc, ldc, rows, N, K);
+    }
+    for (auto& t : workers) t.join();
+}
+
+/**
+ * multiplyMatrices - Multiply two matrices and return the result
+ * @matrix1: The first input matrix
+ * @matrix2: The second input matrix
+ * 
+ * This function multiplies two matrices and returns the result as a new matrix.
+ * For matrix multiplication to be valid, the number of columns in the first matrix
+ * must equal the number of rows in the second matrix.
+ * 
+ * The operands are copied into contiguous row-major buffers and multiplied by
+ * gemmBlocked; the copies cost O(n²) against the O(n³) product.
+ * 
+ * Returns: A new matrix containing the product of the input matrices
+ */
+std::vector<std::vector<int>> multiplyMatrices(const std::vector<std::vector<int>>& matrix1, 
+                                              const std::vector<std::vector<int>>& matrix2) {
+    // Check if matrices are empty
+    if (matrix1.empty() || matrix2.empty()) {
+        throw std::invalid_argument("Matrices cannot be empty");
+    }
+    
+    // Check if multiplication is possible
+    if (matrix1[0].size() != matrix2.size()) {
+        throw std::invalid_argument("Matrix multiplication not possible. Number of columns in first matrix must equal number of rows in second matrix.");
+    }
+    
+    int rows1 = matrix1.size();
+    int cols1 = matrix1[0].size();
+    int cols2 = matrix2[0].size();
+    
+    // Flatten the operands into contiguous row-major storage
+    std::vector<int> a((size_t)rows1 * cols1);
+    std::vector<int> b((size_t)cols1 * cols2);
+    std::vector<int> c((size_t)rows1 * cols2);
+    // Ragged rows would overrun the flat buffers
+    for (int i = 0; i < rows1; i++) {
+        if ((int)matrix1[i].size() != cols1) {
+            throw std::invalid_argument("All rows of a matrix must have the same length");
+        }
+        std::copy(matrix1[i].begin(), matrix1[i].end(), a.begin() + (size_t)i * cols1);
+    }
+    for (int k = 0; k < cols1; k++) {
+        if ((int)matrix2[k].size() != cols2) {
+            throw std::invalid_argument("All rows of a matrix must have the same length");
+        }
+        std::copy(matrix2[k].begin(), matrix2[k].end(), b.begin() + (size_t)k * cols2);
+    }
+    
+    gemmBlocked(a.data(), cols1, b.data(), cols2, c.data(), cols2, rows1, cols2, cols1);
+    
+    std::vector<std::vector<int>> result(rows1);
+    for (int i = 0; i < rows1; i++) {
+        result[i].assign(c.begin() + (size_t)i * cols2, c.begin() + (size_t)(i + 1) * cols2);
+    }
+    
+    return result;
+}
+
+/**
+ * MatrixArena - Bump allocator for the Strassen temporaries
+ * 
+ * One buffer is sized up front for the whole recursion; each level takes its
+ * temporaries from the top and gives them back with release(mark) before
+ * returning, so no heap allocation happens while multiplying.
+ */
+class MatrixArena {
+public:
+    explicit MatrixArena(size_t elements) : buffer_(elements) {}
+    
+    size_t mark() const { return top_; }
+    void release(size_t mark) { top_ = mark; }
+    
+    MatrixView<int> alloc(int rows, int cols) {
+        size_t need = (size_t)rows * cols;
+        if (top_ + need > buffer_.size()) {
+            throw std::logic_error("MatrixArena exhausted");
+        }
+        MatrixView<int> view(buffer_.data() + top_, rows, cols, cols);
+        top_ += need;
+        return view;
+    }
+    
+private:
+    std::vector<int> buffer_;
+    size_t top_ = 0;
+};
+
+// Below this size the Strassen recursion hands over to gemmBlocked.
+// tuneStrassenCrossover() measures a better value for the host machine.
+int strassenCrossover = 512;
+
+/**
+ * strassenArenaSize - Number of arena elements needed to multiply n×n matrices
+ * @n: Matrix dimension
+ * @crossover: Size at which the recursion stops
+ */
+static size_t strassenArenaSize(int n, int crossover) {
+    if (n <= crossover) return 0;
+    if (n % 2 == 1) return strassenArenaSize(n - 1, crossover);
+    size_t h = n / 2;
+    return 4 * h * h + strassenArenaSize(n / 2, crossover);
+}
+
+// Element-wise helpers on equally sized views: dst = a + b, dst = a - b, dst += a
+static void addViews(MatrixView<int> dst, MatrixView<const int> a, MatrixView<const int> b) {
+    for (int i = 0; i < dst.rows(); i++) {
+        int* d = dst.row(i);
+        const int* x = a.row(i);
+        const int* y = b.row(i);
+        for (int j = 0; j < dst.cols(); j++) d[j] = x[j] + y[j];
+    }
+}
+
+static void subViews(MatrixView<int> dst, MatrixView<const int> a, MatrixView<const int> b) {
+    for (int i = 0; i < dst.rows(); i++) {
+        int* d = dst.row(i);
+        const int* x = a.row(i);
+        const int* y = b.row(i);
+        for (int j = 0; j < dst.cols(); j++) d[j] = x[j] - y[j];
+    }
+}
+
+static void accumulateView(MatrixView<int> dst, MatrixView<const int> a) {
+    addViews(dst, dst, a);
+}
+
+// Single-threaded by default: the Strassen leaves are small and numerous, and
+// spawning threads (each with fresh packing buffers) for every one of them
+// costs more than the leaf itself. strassenParallel threads the top level.
+static void gemmViews(MatrixView<const int> A, MatrixView<const int> B, MatrixView<int> C,
+                      bool accumulate = false, unsigned numThreads = 1) {
+    gemmBlocked(A.data(), A.stride(), B.data(), B.stride(), C.data(), C.stride(),
+                A.rows(), B.cols(), A.cols(), numThreads, accumulate);
+}
+
+/**
+ * strassenRec - C = A × B for square n×n views (Strassen–Winograd)
+ * @A, @B: Input views
+ * @C: Output view (overwritten)
+ * @crossover: Size at which to call gemmBlocked instead of recursing
+ * @arena: Source of the per-level temporaries
+ * 
+ * Winograd's variant needs 7 half-size products and 15 additions:
+ *   S1 = A21 + A22   S2 = S1 - A11   S3 = A11 - A21   S4 = A12 - S2
+ *   T1 = B12 - B11   T2 = B22 - T1   T3 = B22 - B12   T4 = T2 - B21
+ *   M1 = A11 B11   M2 = A12 B21   M3 = S4 B22   M4 = A22 T4
+ *   M5 = S1 T1     M6 = S2 T2     M7 = S3 T3
+ *   U2 = M1 + M6   U3 = U2 + M7
+ *   C11 = M1 + M2         C12 = U2 + M5 + M3
+ *   C21 = U3 - M4         C22 = U3 + M5
+ * The quadrants of C double as storage for M1, M3, M4 and M5, so each level
+ * needs only four h×h temporaries. An odd dimension is handled by peeling
+ * off the last row and column and fixing them up with gemmBlocked.
+ */
+static void strassenRec(MatrixView<const int> A, MatrixView<const int> B, MatrixView<int> C,
+                        int crossover, MatrixArena& arena) {
+    int n = A.rows();
+    if (n <= crossover) {
+        gemmViews(A, B, C);
+        return;
+    }
+    
+    if (n % 2 == 1) {
+        int m = n - 1;
+        strassenRec(A.block(0, 0, m, m), B.block(0, 0, m, m), C.block(0, 0, m, m), crossover, arena);
+        // Rank-1 correction for the leading block, then the last column and row
+        gemmViews(A.block(0, m, m, 1), B.block(m, 0, 1, m), C.block(0, 0, m, m), true);
+        gemmViews(A.block(0, 0, m, n), B.block(0, m, n, 1), C.block(0, m, m, 1));
+        gemmViews(A.block(m, 0, 1, n), B, C.block(m, 0, 1, n));
+        return;
+    }
+    
+    int h = n / 2;
+    MatrixView<const int> A11 = A.block(0, 0, h, h), A12 = A.block(0, h, h, h);
+    MatrixView<const int> A21 = A.block(h, 0, h, h), A22 = A.block(h, h, h, h);
+    MatrixView<const int> B11 = B.block(0, 0, h, h), B12 = B.block(0, h, h, h);
+    MatrixView<const int> B21 = B.block(h, 0, h, h), B22 = B.block(h, h, h, h);
+    MatrixView<int> C11 = C.block(0, 0, h, h), C12 = C.block(0, h, h, h);
+    MatrixView<int> C21 = C.block(h, 0, h, h), C22 = C.block(h, h, h, h);
+    
+    size_t mark = arena.mark();
+    MatrixView<int> X = arena.alloc(h, h);  // S1, S2, S4, S3
+    MatrixView<int> Y = arena.alloc(h, h);  // T1, T2, T4, T3
+    MatrixView<int> Q = arena.alloc(h, h);  // M6, then U2, then U3
+    MatrixView<int> P = arena.alloc(h, h);  // M7, then M2
+    
+    addViews(X, A21, A22);                  // X = S1
+    subViews(Y, B12, B11);                  // Y = T1
+    strassenRec(X, Y, C22, crossover, arena);  // C22 = M5
+    
+    subViews(X, X, A11);                    // X = S2
+    subViews(Y, B22, Y);                    // Y = T2
+    strassenRec(X, Y, Q, crossover, arena);    // Q = M6
+    
+    subViews(X, A12, X);                    // X = S4
+    strassenRec(X, B22, C12, crossover, arena);  // C12 = M3
+    
+    subViews(Y, Y, B21);                    // Y = T4
+    strassenRec(A22, Y, C21, crossover, arena);  // C21 = M4
+    
+    strassenRec(A11, B11, C11, crossover, arena);  // C11 = M1
+    accumulateView(Q, C11);                 // Q = U2 = M1 + M6
+    
+    accumulateView(C12, Q);
+    accumulateView(C12, C22);               // C12 = M3 + U2 + M5
+    
+    subViews(X, A11, A21);                  // X = S3
+    subViews(Y, B22, B12);                  // Y = T3
+    strassenRec(X, Y, P, crossover, arena);    // P = M7
+    accumulateView(Q, P);                   // Q = U3 = U2 + M7
+    
+    subViews(C21, Q, C21);                  // C21 = U3 - M4
+    accumulateView(C22, Q);                 // C22 = U3 + M5
+    
+    strassenRec(A12, B21, P, crossover, arena);  // P = M2
+    accumulateView(C11, P);                 // C11 = M1 + M2
+    
+    arena.release(mark);
+}
+
+/**
+ * strassenParallel - C = A × B for square n×n views, first level on @numThreads threads
+ * @A, @B: Input views
+ * @C: Output view (overwritten)
+ * @crossover: Size at which to call gemmBlocked instead of recursing
+ * @numThreads: Number of threads (at least 2)
+ * 
+ * The sequential schedule in strassenRec reuses its temporaries between the
+ * products, which serialises them. Here all eight sums S1..S4, T1..T4 are
+ * formed first and the 7 half-size products are handed out to the threads,
+ * each of which recurses with strassenRec and its own arena. This needs
+ * eleven h×h temporaries at the top level instead of four, but every thread
+ * keeps its packing buffers for the whole recursion.
+ */
+static void strassenParallel(MatrixView<const int> A, MatrixView<const int> B, MatrixView<int> C,
+                             int crossover, unsigned numThreads) {
+    int n = A.rows();
+    if (n <= crossover) {
+        gemmViews(A, B, C, false, numThreads);
+        return;
+    }
+    
+    if (n % 2 == 1) {
+        int m = n - 1;
+        strassenParallel(A.block(0, 0, m, m), B.block(0, 0, m, m), C.block(0, 0, m, m), crossover, numThreads);
+        gemmViews(A.block(0, m, m, 1), B.block(m, 0, 1, m), C.block(0, 0, m, m), true, numThreads);
+        gemmViews(A.block(0, 0, m, n), B.block(0, m, n, 1), C.block(0, m, m, 1));
+        gemmViews(A.block(m, 0, 1, n), B, C.block(m, 0, 1, n));
+        return;
+    }
+    
+    int h = n / 2;
+    MatrixView<const int> A11 = A.block(0, 0, h, h), A12 = A.block(0, h, h, h);
+    MatrixView<const int> A21 = A.block(h, 0, h, h), A22 = A.block(h, h, h, h);
+    MatrixView<const int> B11 = B.block(0, 0, h, h), B12 = B.block(0, h, h, h);
+    MatrixView<const int> B21 = B.block(h, 0, h, h), B22 = B.block(h, h, h, h);
+    MatrixView<int> C11 = C.block(0, 0, h, h), C12 = C.block(0, h, h, h);
+    MatrixView<int> C21 = C.block(h, 0, h, h), C22 = C.block(h, h, h, h);
+    
+    MatrixArena temps((size_t)11 * h * h);
+    MatrixView<int> S1 = temps.alloc(h, h), S2 = temps.alloc(h, h);
+    MatrixView<int> S3 = temps.alloc(h, h), S4 = temps.alloc(h, h);
+    MatrixView<int> T1 = temps.alloc(h, h), T2 = temps.alloc(h, h);
+    MatrixView<int> T3 = temps.alloc(h, h), T4 = temps.alloc(h, h);
+    MatrixView<int> M2 = temps.alloc(h, h), M6 = temps.alloc(h, h), M7 = temps.alloc(h, h);
+    
+    addViews(S1, A21, A22);
+    subViews(S2, S1, A11);
+    subViews(S3, A11, A21);
+    subViews(S4, A12, S2);
+    subViews(T1, B12, B11);
+    subViews(T2, B22, T1);
+    subViews(T3, B22, B12);
+    subViews(T4, T2, B21);
+    
+    // The quadrants of C hold M1, M3, M4 and M5 as in strassenRec
+    struct Product { MatrixView<const int> a, b; MatrixView<int> c; };
+    const Product products[7] = {
+        {A11, B11, C11}, {A12, B21, M2}, {S4, B22, C12}, {A22, T4, C21},
+        {S1, T1, C22},   {S2, T2, M6},   {S3, T3, M7},
+    };
+    
+    std::atomic<int> next{0};
+    size_t arenaSize = strassenArenaSize(h, crossover);
+    auto worker = [&] {
+        MatrixArena arena(arenaSize);
+        for (int p = next++; p < 7; p = next++) {
+            strassenRec(products[p].a, products[p].b, products[p].c, crossover, arena);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < std::min(numThreads, 7u); t++) workers.emplace_back(worker);
+    worker();
+    for (auto& t : workers) t.join();
+    
+    accumulateView(M6, C11);                // M6 = U2 = M1 + M6
+    accumulateView(C12, M6);
+    accumulateView(C12, C22);               // C12 = M3 + U2 + M5
+    accumulateView(M6, M7);                 // M6 = U3 = U2 + M7
+    subViews(C21, M6, C21);                 // C21 = U3 - M4
+    accumulateView(C22, M6);                // C22 = U3 + M5
+    accumulateView(C11, M2);                // C11 = M1 + M2
+}
+
+/**
+ * multiplyStrassen - Strassen–Winograd product of two square matrices
+ * @A: n×n input matrix (or view)
+ * @B: n×n input matrix (or view)
+ * @C: n×n output view (overwritten; must not overlap the inputs)
+ * @crossover: Recursion cut-off (0 = use strassenCrossover)
+ * @numThreads: Number of threads (0 = one per hardware thread)
+ * 
+ * Does O(n^2.81) work instead of O(n³). Intermediate sums such as
+ * A21 + A22 - A11 can exceed the range of the final result, so the result is
+ * only guaranteed to match gemmBlocked when no intermediate overflows.
+ */
+void multiplyStrassen(MatrixView<const int> A, MatrixView<const int> B, MatrixView<int> C,
+                      int crossover = 0, unsigned numThreads = 0) {
+    if (!A.isSquare() || !B.isSquare() || A.rows() != B.rows() ||
+        C.rows() != A.rows() || C.cols() != A.rows()) {
+        throw std::invalid_argument("Strassen multiplication needs square matrices of the same size");
+    }
+    if (crossover <= 0) crossover = strassenCrossover;
+    crossover = std::max(crossover, 16);
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (numThreads > 1) {
+        strassenParallel(A, B, C, crossover, numThreads);
+        return;
+    }
+    
+    MatrixArena arena(strassenArenaSize(A.rows(), crossover));
+    strassenRec(A, B, C, crossover, arena);
+}
+
+/**
+ * MultiplyAlgorithm - Algorithm used by multiplyMatrices on contiguous matrices
+ * @Blocked: Cache-blocked GEMM (always exact)
+ * @Strassen: Strassen–Winograd for square products larger than the
+ *            crossover, gemmBlocked otherwise
+ */
+enum class MultiplyAlgorithm { Blocked, Strassen };
+
+/**
+ * multiplyMatrices - Multiply two contiguous matrices (or matrix views)
+ * @matrix1: The first input matrix
+ * @matrix2: The second input matrix
+ * @algorithm: Blocked GEMM, or Strassen–Winograd for large square products
+ * 
+ * Contiguous storage can be handed to gemmBlocked directly, so unlike the
+ * vector-of-vectors version no copies of the operands are made.
+ * 
+ * Returns: A new matrix containing the product of the input matrices
+ */
+Matrix<int> multiplyMatrices(MatrixView<const int> matrix1, MatrixView<const int> matrix2,
+                             MultiplyAlgorithm algorithm = MultiplyAlgorithm::Blocked) {
+    if (matrix1.empty() || matrix2.empty()) {
+        throw std::invalid_argument("Matrices cannot be empty");
+    }
+    if (matrix1.cols() != matrix2.rows()) {
+        throw std::invalid_argument("Matrix multiplication not possible. Number of columns in first matrix must equal number of rows in second matrix.");
+    }
+    
+    Matrix<int> result(matrix1.rows(), matrix2.cols());
+    if (algorithm == MultiplyAlgorithm::Strassen && matrix1.isSquare() && matrix2.isSquare() &&
+        matrix1.rows() > strassenCrossover) {
+        multiplyStrassen(matrix1, matrix2, result);
+        return result;
+    }
+    gemmBlocked(matrix1.data(), matrix1.stride(), matrix2.data(), matrix2.stride(),
+                result.data(), result.stride(), matrix1.rows(), matrix2.cols(), matrix1.cols());
+    return result;
+}
+
 /**
  * printMatrix - Print a matrix
  * @matrix: The matrix to print
@@ -81,7 +707,119 @@ std::pair<int, int> getMatrixDimensions(const std::vector<std::vector<int>>& mat
     return {matrix.size(), matrix[0].size()};
 }
 
-int main() {
+/**
+ * benchmarkMultiply - Compare the naive triple loop with the blocked GEMM
+ * @n: Dimension of the square matrices
+ * 
+ * Prints the wall-clock time and GFLOP/s (2n³ operations) of both versions and
+ * checks that they produce the same result. The naive loop is skipped above
+ * n = 2048 because it takes minutes.
+ */
+void benchmarkMultiply(int n) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(-8, 8);
+    
+    std::vector<std::vector<int>> m1(n, std::vector<int>(n)), m2(n, std::vector<int>(n));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            m1[i][j] = dist(rng);
+            m2[i][j] = dist(rng);
+        }
+    }
+    
+    double flops = 2.0 * n * n * n;
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    std::vector<std::vector<int>> blocked, naive;
+    double tBlocked = timeIt([&] { blocked = multiplyMatrices(m1, m2); });
+    
+    std::cout << "n = " << n << std::endl;
+    std::cout << "  blocked GEMM: " << std::fixed << std::setprecision(3) << tBlocked << " s, "
+              << flops / tBlocked * 1e-9 << " GFLOP/s" << std::endl;
+    
+    if (n <= 2048) {
+        double tNaive = timeIt([&] { naive = multiplyMatricesNaive(m1, m2); });
+        std::cout << "  naive i-j-k:  " << tNaive << " s, " << flops / tNaive * 1e-9 << " GFLOP/s" << std::endl;
+        std::cout << "  speedup:      " << tNaive / tBlocked << "x, results "
+                  << (naive == blocked ? "match" : "DIFFER") << std::endl;
+    }
+    std::cout.unsetf(std::ios::fixed);
+}
+
+/**
+ * tuneStrassenCrossover - Pick the fastest Strassen crossover for this machine
+ * @n: Dimension of the square test product
+ * 
+ * Times multiplyStrassen with a range of crossovers (and gemmBlocked alone),
+ * prints the table, stores the winner in strassenCrossover and returns it.
+ */
+int tuneStrassenCrossover(int n) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(-8, 8);
+    Matrix<int> a(n, n), b(n, n), reference(n, n), c(n, n);
+    for (size_t k = 0; k < a.size(); k++) {
+        a.data()[k] = dist(rng);
+        b.data()[k] = dist(rng);
+    }
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    double best = timeIt([&] { gemmViews(a, b, reference, false, 0); });
+    int bestCrossover = n;
+    std::cout << "n = " << n << std::endl;
+    std::cout << "  gemmBlocked only:     " << std::fixed << std::setprecision(3) << best << " s" << std::endl;
+    
+    for (int crossover = 64; crossover < n; crossover *= 2) {
+        double t = timeIt([&] { multiplyStrassen(a, b, c, crossover); });
+        std::cout << "  crossover " << std::setw(5) << crossover << ":      " << t << " s"
+                  << (c == reference ? "" : "  (MISMATCH)") << std::endl;
+        if (t < best) {
+            best = t;
+            bestCrossover = crossover;
+        }
+    }
+    std::cout.unsetf(std::ios::fixed);
+    
+    strassenCrossover = bestCrossover;
+    std::cout << "  chosen crossover: " << bestCrossover
+              << (bestCrossover == n ? " (Strassen does not pay off at this size)" : "") << std::endl;
+    return bestCrossover;
+}
+
+/**
+ * printMatrix - Print a contiguous matrix or matrix view
+ * @matrix: The matrix to print
+ */
+void printMatrix(MatrixView<const int> matrix) {
+    for (int i = 0; i < matrix.rows(); i++) {
+        for (int j = 0; j < matrix.cols(); j++) {
+            std::cout << std::setw(4) << matrix(i, j);
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        std::vector<int> sizes;
+        for (int i = 2; i < argc; i++) sizes.push_back(std::stoi(argv[i]));
+        if (sizes.empty()) sizes = {256, 512, 1024};
+        for (int n : sizes) benchmarkMultiply(n);
+        return 0;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--tune-strassen") {
+        tuneStrassenCrossover(argc > 2 ? std::stoi(argv[2]) : 2048);
+        return 0;
+    }
+    
     // Example matrices
     std::vector<std::vector<int>> matrix1 = {
         {1, 2, 3},
@@ -176,5 +914,11 @@ int main() {
         std::cerr << "\nError: " << e.what() << std::endl;
     }
     
+    // Example 4: Contiguous matrices, multiplying a submatrix view
+    Matrix<int> flat6 = Matrix<int>::fromVectors(matrix6);
+    
+    std::cout << "\nExample 4: Matrix 5 x top-left 2x3 block of Matrix 6 (contiguous storage)" << std::endl;
+    printMatrix(multiplyMatrices(Matrix<int>::fromVectors(matrix5), flat6.block(0, 0, 2, 3)));
+    
     return 0;
 }
\ No newline at end of file
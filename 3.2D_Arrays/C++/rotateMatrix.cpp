@@ -7,6 +7,13 @@
  * 1. Transpose the matrix (swap rows with columns)
  * 2. Reverse each row of the transposed matrix
  * 
+ * For contiguous Matrix<int> storage there is also a general API:
+ * - rotateMatrixInto: 0/90/180/270 degrees, square or rectangular, into a
+ *   caller-supplied buffer (no allocation)
+ * - rotateMatrixInPlace: the same rotations in place, including rectangular
+ *   matrices (their dimensions are swapped)
+ * Both use the blocked transpose from transpose.h and AVX2 row reversal.
+ * 
  * Time Complexity: O(n²) where n is the dimension of the matrix
  * Space Complexity: O(1) for in-place rotation
  * 
@@ -17,6 +24,13 @@
 #include <iostream>
 #include <vector>
 #include <algorithm> // for std::reverse
+#include <stdexcept>
+#include "matrix.h"
+#include "transpose.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 /**
  * rotateMatrix90Clockwise - Rotate a square matrix 90 degrees clockwise in-place
@@ -102,6 +116,243 @@ std::vector<std::vector<int>> rotateMatrix90ClockwiseNew(const std::vector<std::
     return result;
 }
 
+/**
+ * reverseRow - Reverse n contiguous ints in place
+ * @row: Pointer to the first element
+ * @n: Number of elements (a size_t, so a whole matrix fits)
+ * 
+ * With AVX2, 8 elements are taken from each end, reversed in registers with a
+ * lane permute and stored crosswise.
+ */
+static void reverseRow(int* row, size_t n) {
+    size_t lo = 0, hi = n;
+#if defined(__AVX2__)
+    const __m256i rev = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    while (hi - lo >= 16) {
+        __m256i front = _mm256_loadu_si256((const __m256i*)(row + lo));
+        __m256i back = _mm256_loadu_si256((const __m256i*)(row + hi - 8));
+        _mm256_storeu_si256((__m256i*)(row + lo), _mm256_permutevar8x32_epi32(back, rev));
+        _mm256_storeu_si256((__m256i*)(row + hi - 8), _mm256_permutevar8x32_epi32(front, rev));
+        lo += 8;
+        hi -= 8;
+    }
+#endif
+    std::reverse(row + lo, row + hi);
+}
+
+/**
+ * reverseCopyRow - Copy n ints from src to dst in reverse order
+ * @src: Source row
+ * @dst: Destination row (must not overlap @src)
+ * @n: Number of elements
+ */
+static void reverseCopyRow(const int* src, int* dst, int n) {
+    int j = 0;
+#if defined(__AVX2__)
+    const __m256i rev = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    for (; j + 8 <= n; j += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + n - 8 - j));
+        _mm256_storeu_si256((__m256i*)(dst + j), _mm256_permutevar8x32_epi32(v, rev));
+    }
+#endif
+    for (; j < n; j++) {
+        dst[j] = src[n - 1 - j];
+    }
+}
+
+/**
+ * normalizeDegrees - Map a clockwise angle to 0, 90, 180 or 270
+ * @degrees: Clockwise rotation; negative values rotate counter-clockwise
+ * 
+ * Throws std::invalid_argument if @degrees is not a multiple of 90.
+ */
+static int normalizeDegrees(int degrees) {
+    if (degrees % 90 != 0) {
+        throw std::invalid_argument("Rotation must be a multiple of 90 degrees");
+    }
+    return ((degrees % 360) + 360) % 360;
+}
+
+/**
+ * rotateMatrixInto - Rotate a matrix clockwise into a caller-supplied buffer
+ * @src: The rows×cols input matrix (or view), square or not
+ * @dst: Output view; cols×rows for 90/270 degrees, rows×cols for 0/180.
+ *       Must not overlap @src
+ * @degrees: Clockwise rotation, a multiple of 90 (negative = counter-clockwise)
+ * 
+ * No memory is allocated:
+ * - 90:  blocked transpose into dst, then reverse every row of dst
+ * - 270: blocked transpose into dst, then reverse the order of the rows
+ * - 180: copy row i of src reversed into row rows-1-i of dst
+ */
+void rotateMatrixInto(MatrixView<const int> src, MatrixView<int> dst, int degrees) {
+    degrees = normalizeDegrees(degrees);
+    bool quarterTurn = degrees == 90 || degrees == 270;
+    int outRows = quarterTurn ? src.cols() : src.rows();
+    int outCols = quarterTurn ? src.rows() : src.cols();
+    if (dst.rows() != outRows || dst.cols() != outCols) {
+        throw std::invalid_argument("Destination has the wrong dimensions for this rotation");
+    }
+    
+    int rows = src.rows();
+    int cols = src.cols();
+    
+    switch (degrees) {
+        case 0:
+            for (int i = 0; i < rows; i++) {
+                std::copy(src.row(i), src.row(i) + cols, dst.row(i));
+            }
+            break;
+        case 90:
+            transposeBlocked(src, dst);
+            for (int i = 0; i < outRows; i++) {
+                reverseRow(dst.row(i), outCols);
+            }
+            break;
+        case 180:
+            for (int i = 0; i < rows; i++) {
+                reverseCopyRow(src.row(i), dst.row(rows - 1 - i), cols);
+            }
+            break;
+        case 270:
+            transposeBlocked(src, dst);
+            for (int i = 0; i < outRows / 2; i++) {
+                std::swap_ranges(dst.row(i), dst.row(i) + outCols, dst.row(outRows - 1 - i));
+            }
+            break;
+    }
+}
+
+/**
+ * rotateSquareInPlace - Rotate a square matrix (or square view) clockwise in place
+ * @matrix: The n×n matrix
+ * @degrees: Clockwise rotation, a multiple of 90
+ */
+void rotateSquareInPlace(MatrixView<int> matrix, int degrees) {
+    if (!matrix.isSquare()) {
+        throw std::invalid_argument("In-place rotation of a view requires a square matrix");
+    }
+    degrees = normalizeDegrees(degrees);
+    int n = matrix.rows();
+    
+    if (degrees == 90 || degrees == 270) {
+        transposeInPlaceBlocked(matrix);
+    }
+    if (degrees == 90 || degrees == 180) {
+        for (int i = 0; i < n; i++) {
+            reverseRow(matrix.row(i), n);
+        }
+    }
+    if (degrees == 180 || degrees == 270) {
+        for (int i = 0; i < n / 2; i++) {
+            std::swap_ranges(matrix.row(i), matrix.row(i) + n, matrix.row(n - 1 - i));
+        }
+    }
+}
+
+/**
+ * transposeRectangularInPlace - Transpose a contiguous rows×cols block in place
+ * @data: rows×cols elements in row-major order; on return cols×rows elements
+ * @rows: Number of rows
+ * @cols: Number of columns
+ * 
+ * Follows the permutation cycles k -> k·rows mod (rows·cols - 1). A bit per
+ * element marks the positions already placed, i.e. rows·cols/8 bytes of
+ * bookkeeping instead of a second copy of the matrix.
+ */
+static void transposeRectangularInPlace(int* data, int rows, int cols) {
+    size_t total = (size_t)rows * cols;
+    if (total < 3) return;
+    size_t mod = total - 1;
+    std::vector<bool> placed(total, false);
+    
+    for (size_t start = 1; start < mod; start++) {
+        if (placed[start]) continue;
+        size_t k = start;
+        int carried = data[k];
+        do {
+            // Element at linear index k = i·cols + j moves to j·rows + i
+            size_t next = (k * rows) % mod;
+            std::swap(carried, data[next]);
+            placed[next] = true;
+            k = next;
+        } while (k != start);
+    }
+}
+
+/**
+ * rotateMatrixInPlace - Rotate an owning contiguous matrix clockwise in place
+ * @matrix: The matrix, square or not; its dimensions are swapped for 90/270
+ * @degrees: Clockwise rotation, a multiple of 90
+ * 
+ * Square matrices use the blocked transpose plus row reversal. Rectangular
+ * matrices are transposed by cycle-following and then reshaped.
+ */
+void rotateMatrixInPlace(Matrix<int>& matrix, int degrees) {
+    degrees = normalizeDegrees(degrees);
+    if (degrees == 0) return;
+    if (matrix.isSquare() || degrees == 180) {
+        if (degrees == 180) {
+            // Rotating by 180 degrees reverses the whole row-major sequence
+            reverseRow(matrix.data(), matrix.size());
+        } else {
+            rotateSquareInPlace(matrix, degrees);
+        }
+        return;
+    }
+    
+    int rows = matrix.rows();
+    int cols = matrix.cols();
+    transposeRectangularInPlace(matrix.data(), rows, cols);
+    matrix.reshape(cols, rows);
+    
+    if (degrees == 90) {
+        for (int i = 0; i < cols; i++) {
+            reverseRow(matrix.row(i), rows);
+        }
+    } else {
+        for (int i = 0; i < cols / 2; i++) {
+            std::swap_ranges(matrix.row(i), matrix.row(i) + rows, matrix.row(cols - 1 - i));
+        }
+    }
+}
+
+/**
+ * rotateMatrix90Clockwise - Rotate a contiguous square matrix 90 degrees clockwise in-place
+ * @matrix: The input square matrix (or square view)
+ */
+void rotateMatrix90Clockwise(MatrixView<int> matrix) {
+    if (matrix.empty() || !matrix.isSquare()) {
+        std::cout << "Error: Not a square matrix" << std::endl;
+        return;
+    }
+    rotateSquareInPlace(matrix, 90);
+}
+
+/**
+ * rotateMatrix90CounterClockwise - Rotate a contiguous square matrix 90 degrees counter-clockwise
+ * @matrix: The input square matrix (or square view)
+ */
+void rotateMatrix90CounterClockwise(MatrixView<int> matrix) {
+    if (matrix.empty() || !matrix.isSquare()) {
+        std::cout << "Error: Not a square matrix" << std::endl;
+        return;
+    }
+    rotateSquareInPlace(matrix, 270);
+}
+
+/**
+ * rotateMatrix90ClockwiseNew - Create a new rotated contiguous matrix
+ * @matrix: The input matrix (or matrix view), square or not
+ * 
+ * Returns: A new matrix rotated 90 degrees clockwise
+ */
+Matrix<int> rotateMatrix90ClockwiseNew(MatrixView<const int> matrix) {
+    Matrix<int> result(matrix.cols(), matrix.rows());
+    rotateMatrixInto(matrix, result, 90);
+    return result;
+}
+
 /**
  * printMatrix - Print a matrix
  * @matrix: The matrix to print
@@ -117,6 +368,19 @@ void printMatrix(const std::vector<std::vector<int>>& matrix) {
     }
 }
 
+/**
+ * printMatrix - Print a contiguous matrix or matrix view
+ * @matrix: The matrix to print
+ */
+void printMatrix(MatrixView<const int> matrix) {
+    for (int i = 0; i < matrix.rows(); i++) {
+        for (int j = 0; j < matrix.cols(); j++) {
+            std::cout << matrix(i, j) << "\t";
+        }
+        std::cout << std::endl;
+    }
+}
+
 int main() {
     // Example: Square matrix
     std::vector<std::vector<int>> matrix = {
@@ -161,5 +425,34 @@ int main() {
     std::cout << "\nRotated 90 degrees clockwise (new matrix):" << std::endl;
     printMatrix(rotatedNonSquare);
     
+    // Example: Contiguous matrix storage
+    Matrix<int> flat = Matrix<int>::fromVectors(matrix);
+    rotateMatrix90CounterClockwise(flat);
+    
+    std::cout << "\nContiguous Matrix<int> rotated 90 degrees counter-clockwise:" << std::endl;
+    printMatrix(flat);
+    
+    std::cout << "\nNon-square Matrix<int> rotated 90 degrees clockwise (new matrix):" << std::endl;
+    printMatrix(rotateMatrix90ClockwiseNew(Matrix<int>::fromVectors(nonSquareMatrix)));
+    
+    // Example: Any multiple of 90 degrees into a preallocated buffer
+    Matrix<int> tile = Matrix<int>::fromVectors(nonSquareMatrix);
+    Matrix<int> quarter(tile.cols(), tile.rows());
+    Matrix<int> half(tile.rows(), tile.cols());
+    
+    rotateMatrixInto(tile, quarter, 270);
+    std::cout << "\nNon-square matrix rotated 270 degrees clockwise (caller buffer):" << std::endl;
+    printMatrix(quarter);
+    
+    rotateMatrixInto(tile, half, 180);
+    std::cout << "\nNon-square matrix rotated 180 degrees (caller buffer):" << std::endl;
+    printMatrix(half);
+    
+    // Example: In-place rotation of a non-square matrix
+    rotateMatrixInPlace(tile, 90);
+    std::cout << "\nNon-square matrix rotated 90 degrees clockwise in place (now "
+              << tile.rows() << "x" << tile.cols() << "):" << std::endl;
+    printMatrix(tile);
+    
     return 0;
 }
\ No newline at end of file
@@ -11,6 +11,12 @@
  * 4. If the current element is less than the target, move down (eliminate the current row)
  * 5. Repeat until the element is found or the search space is exhausted
  * 
+ * Batch search (searchMatrixBatch) answers many targets at once: the targets
+ * are sorted, and a per-line "frontier" (first column in each row holding a
+ * value >= target) only moves forward as the targets grow, so each probe
+ * resumes where the previous one stopped. Large batches are split across threads.
+ * Benchmark: ./searchMatrix --bench [n] [queries]
+ * 
  * Time Complexity: O(m+n) where m and n are the dimensions of the matrix
  * Space Complexity: O(1)
  * 
@@ -21,6 +27,13 @@
 #include <iostream>
 #include <vector>
 #include <utility> // for std::pair
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <string>
+#include "matrix.h"
 
 /**
  * searchMatrix - Search for a target value in a sorted matrix
@@ -111,6 +124,213 @@ std::pair<int, int> searchMatrixBinary(const std::vector<std::vector<int>>& matr
     return {-1, -1};
 }
 
+/**
+ * searchMatrix - Search a contiguous matrix (or view) sorted row-wise and column-wise
+ * @matrix: The input sorted matrix
+ * @target: The value to search for
+ * 
+ * Returns: The (row, col) of the target, or (-1, -1) if not found
+ */
+std::pair<int, int> searchMatrix(MatrixView<const int> matrix, int target) {
+    if (matrix.empty()) {
+        return {-1, -1};
+    }
+    
+    // Start from the top-right corner
+    int i = 0;
+    int j = matrix.cols() - 1;
+    
+    while (i < matrix.rows() && j >= 0) {
+        int value = matrix(i, j);
+        if (value == target) {
+            return {i, j};
+        } else if (value > target) {
+            j--;
+        } else {
+            i++;
+        }
+    }
+    
+    return {-1, -1};
+}
+
+/**
+ * searchMatrixBinary - Binary search a contiguous matrix (or view) that flattens to a sorted array
+ * @matrix: The input matrix (each row starts after the previous row ends)
+ * @target: The value to search for
+ * 
+ * Returns: The (row, col) of the target, or (-1, -1) if not found
+ */
+std::pair<int, int> searchMatrixBinary(MatrixView<const int> matrix, int target) {
+    if (matrix.empty()) {
+        return {-1, -1};
+    }
+    
+    int cols = matrix.cols();
+    long long left = 0;
+    long long right = (long long)matrix.rows() * cols - 1;
+    
+    while (left <= right) {
+        long long mid = left + (right - left) / 2;
+        int midRow = (int)(mid / cols);
+        int midCol = (int)(mid % cols);
+        int value = matrix(midRow, midCol);
+        
+        if (value == target) {
+            return {midRow, midCol};
+        } else if (value < target) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    
+    return {-1, -1};
+}
+
+/**
+ * searchSortedRun - Answer an ascending run of targets with a shared frontier
+ * @at: Accessor at(i, j) for a matrix sorted along both dimensions
+ * @m: Number of lines the frontier tracks (the smaller dimension)
+ * @n: Length of each line
+ * @targets: Targets in ascending order
+ * @count: Number of targets
+ * @out: Receives the (line, index) of each target, or (-1, -1)
+ * 
+ * frontier[i] is a lower bound on the first index of line i holding a value
+ * >= the current target. It never has to move backwards for a larger target,
+ * and line i+1 can start from the frontier of line i+1 since every line is
+ * element-wise >= the one above it. Walking the lines bottom-up therefore
+ * costs O(m + distance advanced), and the advances sum to at most m×n over
+ * the whole run.
+ */
+template <typename At>
+static void searchSortedRun(At at, int m, int n, const int* targets, size_t count,
+                            std::pair<int, int>* out) {
+    if (count == 0) return;
+    
+    // Seed the frontier for the first target with one binary search per line
+    std::vector<int> frontier(m);
+    for (int i = 0; i < m; i++) {
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (at(i, mid) < targets[0]) lo = mid + 1;
+            else hi = mid;
+        }
+        frontier[i] = lo;
+    }
+    
+    for (size_t q = 0; q < count; q++) {
+        int target = targets[q];
+        if (q > 0 && target == targets[q - 1]) {
+            out[q] = out[q - 1];
+            continue;
+        }
+        
+        out[q] = {-1, -1};
+        int j = 0;
+        for (int i = m - 1; i >= 0; i--) {
+            j = std::max(j, frontier[i]);
+            while (j < n && at(i, j) < target) j++;
+            frontier[i] = j;
+            if (j == n) continue;
+            if (at(i, j) == target) {
+                // Lines above keep stale (smaller) frontiers, which are still valid lower bounds
+                out[q] = {i, j};
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * searchSortedTargets - Dispatch an ascending run to the row or column frontier
+ * @matrix: The input matrix sorted row-wise and column-wise
+ * @targets: Targets in ascending order
+ * @count: Number of targets
+ * @out: Receives the (row, col) of each target, or (-1, -1)
+ * 
+ * The frontier is kept over the smaller dimension so each probe touches as
+ * few lines as possible.
+ */
+static void searchSortedTargets(MatrixView<const int> matrix, const int* targets, size_t count,
+                                std::pair<int, int>* out) {
+    if (matrix.rows() <= matrix.cols()) {
+        searchSortedRun([&](int i, int j) { return matrix(i, j); },
+                        matrix.rows(), matrix.cols(), targets, count, out);
+    } else {
+        searchSortedRun([&](int i, int j) { return matrix(j, i); },
+                        matrix.cols(), matrix.rows(), targets, count, out);
+        for (size_t q = 0; q < count; q++) {
+            if (out[q].first != -1) std::swap(out[q].first, out[q].second);
+        }
+    }
+}
+
+/**
+ * searchMatrixBatch - Search for many targets in a sorted matrix at once
+ * @matrix: The input matrix sorted row-wise and column-wise
+ * @targets: The values to search for, in any order
+ * @numThreads: Number of worker threads (0 = one per hardware thread)
+ * 
+ * Unsorted targets are ordered through an index permutation first. The
+ * ascending run is then cut into contiguous slices, one per thread, each
+ * with its own frontier; small batches stay on the calling thread.
+ * 
+ * Returns: For each target (in the original order) its (row, col), or
+ *          (-1, -1) if not found
+ */
+std::vector<std::pair<int, int>> searchMatrixBatch(MatrixView<const int> matrix,
+                                                   const std::vector<int>& targets,
+                                                   unsigned numThreads = 0) {
+    size_t count = targets.size();
+    std::vector<std::pair<int, int>> results(count, {-1, -1});
+    if (count == 0 || matrix.empty()) {
+        return results;
+    }
+    
+    // Put the targets in ascending order (skipped when they already are)
+    bool sorted = std::is_sorted(targets.begin(), targets.end());
+    std::vector<size_t> order;
+    std::vector<int> sortedTargets;
+    std::vector<std::pair<int, int>> sortedResults;
+    if (!sorted) {
+        order.resize(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return targets[a] < targets[b]; });
+        sortedTargets.resize(count);
+        for (size_t q = 0; q < count; q++) sortedTargets[q] = targets[order[q]];
+        sortedResults.resize(count);
+    }
+    const int* run = sorted ? targets.data() : sortedTargets.data();
+    std::pair<int, int>* out = sorted ? results.data() : sortedResults.data();
+    
+    // Only fan out when every thread gets a sizeable slice
+    const size_t minPerThread = 1 << 14;
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = (unsigned)std::min<size_t>(numThreads, std::max<size_t>(1, count / minPerThread));
+    
+    if (numThreads <= 1) {
+        searchSortedTargets(matrix, run, count, out);
+    } else {
+        size_t perThread = (count + numThreads - 1) / numThreads;
+        std::vector<std::thread> workers;
+        for (size_t start = 0; start < count; start += perThread) {
+            size_t len = std::min(perThread, count - start);
+            workers.emplace_back(searchSortedTargets, matrix, run + start, len, out + start);
+        }
+        for (auto& t : workers) t.join();
+    }
+    
+    if (!sorted) {
+        for (size_t q = 0; q < count; q++) results[order[q]] = sortedResults[q];
+    }
+    return results;
+}
+
 /**
  * printMatrix - Print a matrix
  * @matrix: The matrix to print
@@ -126,7 +346,66 @@ void printMatrix(const std::vector<std::vector<int>>& matrix) {
     }
 }
 
-int main() {
+/**
+ * benchmarkBatchSearch - Compare one-at-a-time probes with searchMatrixBatch
+ * @n: Dimension of the square test matrix
+ * @queries: Number of random targets
+ * 
+ * Prints probes per second for both, on unsorted and on pre-sorted targets,
+ * and checks that every batch answer points at the right value.
+ */
+void benchmarkBatchSearch(int n, int queries) {
+    Matrix<int> matrix(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            matrix(i, j) = 3 * i + 2 * j;
+        }
+    }
+    
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(-10, 5 * n);
+    std::vector<int> targets(queries);
+    for (int& t : targets) t = dist(rng);
+    std::vector<int> sortedTargets = targets;
+    std::sort(sortedTargets.begin(), sortedTargets.end());
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    
+    for (const auto* batch : {&targets, &sortedTargets}) {
+        std::vector<std::pair<int, int>> single(batch->size()), batched;
+        double tSingle = timeIt([&] {
+            for (size_t q = 0; q < batch->size(); q++) single[q] = searchMatrix(matrix, (*batch)[q]);
+        });
+        double tBatch = timeIt([&] { batched = searchMatrixBatch(matrix, *batch); });
+        
+        bool ok = true;
+        for (size_t q = 0; q < batch->size(); q++) {
+            bool foundSingle = single[q].first != -1;
+            bool foundBatch = batched[q].first != -1;
+            if (foundSingle != foundBatch ||
+                (foundBatch && matrix(batched[q].first, batched[q].second) != (*batch)[q])) {
+                ok = false;
+            }
+        }
+        
+        std::cout << (batch == &targets ? "unsorted" : "sorted  ") << " targets: one-by-one "
+                  << queries / tSingle * 1e-6 << " M probes/s, batch " << queries / tBatch * 1e-6
+                  << " M probes/s" << (ok ? "" : "  (MISMATCH)") << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        int n = argc > 2 ? std::stoi(argv[2]) : 1000;
+        int queries = argc > 3 ? std::stoi(argv[3]) : 1000000;
+        benchmarkBatchSearch(n, queries);
+        return 0;
+    }
+    
     // Example 1: Matrix sorted both row-wise and column-wise
     std::vector<std::vector<int>> matrix1 = {
         {10, 20, 30, 40},
@@ -178,5 +457,21 @@ int main() {
         }
     }
     
+    // Example 3: Contiguous matrix storage
+    Matrix<int> flat = Matrix<int>::fromVectors(matrix1);
+    
+    std::cout << "\nExample 3: Same searches on contiguous Matrix<int> storage" << std::endl;
+    for (int target : targets1) {
+        auto [row, col] = searchMatrix(flat, target);
+        std::cout << "Target " << target << " -> (" << row << ", " << col << ")" << std::endl;
+    }
+    
+    // Example 4: All targets of Example 1 in one batch
+    std::cout << "\nExample 4: Batch search of Example 1 targets" << std::endl;
+    std::vector<std::pair<int, int>> batch = searchMatrixBatch(flat, targets1);
+    for (size_t q = 0; q < targets1.size(); q++) {
+        std::cout << "Target " << targets1[q] << " -> (" << batch[q].first << ", " << batch[q].second << ")" << std::endl;
+    }
+    
     return 0;
 }
\ No newline at end of file
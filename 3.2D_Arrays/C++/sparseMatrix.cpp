@@ -0,0 +1,593 @@
+/**
+ * Sparse Matrices (CSR / CSC)
+ *
+ * This program demonstrates compressed sparse storage for matrices that are
+ * mostly zeros, next to the dense routines in this directory.
+ *
+ * CSR (Compressed Sparse Row) keeps, for every row, the column indices and
+ * values of its non-zeros:
+ *     rowPtr[i] .. rowPtr[i+1]-1  index the non-zeros of row i
+ *     colIdx[k], values[k]        column and value of the k-th non-zero
+ * CSC is the same layout by columns, i.e. the CSR form of the transpose.
+ *
+ * Operations:
+ * 1. Conversion from dense (vector-of-vectors or Matrix<int>) and back
+ * 2. Sparse transpose / CSR <-> CSC in O(nnz + n) with a counting sort
+ * 3. SpMV (sparse × vector) and SpMM (sparse × dense, sparse × sparse),
+ *    split across threads in row ranges holding similar numbers of non-zeros
+ * 4. Sparse addition and symmetry check
+ *
+ * Benchmark: ./sparseMatrix --bench [n]   (compares with dense across densities)
+ *
+ * Time Complexity: O(nnz) for conversion-free operations, O(m×n) for conversion
+ * Space Complexity: O(nnz + m) per matrix
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <string>
+#include <utility>
+#include "matrix.h"
+
+/**
+ * CsrMatrix - Sparse matrix in compressed sparse row format
+ *
+ * Column indices inside a row are strictly increasing and no explicit zeros
+ * are stored.
+ */
+struct CsrMatrix {
+    int rows = 0;
+    int cols = 0;
+    std::vector<int> rowPtr{0};
+    std::vector<int> colIdx;
+    std::vector<int> values;
+
+    size_t nonZeros() const { return values.size(); }
+};
+
+/**
+ * CscMatrix - Sparse matrix in compressed sparse column format
+ */
+struct CscMatrix {
+    int rows = 0;
+    int cols = 0;
+    std::vector<int> colPtr{0};
+    std::vector<int> rowIdx;
+    std::vector<int> values;
+
+    size_t nonZeros() const { return values.size(); }
+};
+
+/**
+ * toCsr - Compress a dense matrix (or view) into CSR form
+ * @matrix: The dense input matrix
+ *
+ * Returns: The CSR form holding only the non-zero elements
+ */
+CsrMatrix toCsr(MatrixView<const int> matrix) {
+    CsrMatrix sparse;
+    sparse.rows = matrix.rows();
+    sparse.cols = matrix.cols();
+    sparse.rowPtr.assign(1, 0);
+    sparse.rowPtr.reserve(sparse.rows + 1);
+
+    for (int i = 0; i < matrix.rows(); i++) {
+        const int* row = matrix.row(i);
+        for (int j = 0; j < matrix.cols(); j++) {
+            if (row[j] != 0) {
+                sparse.colIdx.push_back(j);
+                sparse.values.push_back(row[j]);
+            }
+        }
+        sparse.rowPtr.push_back((int)sparse.values.size());
+    }
+    return sparse;
+}
+
+/**
+ * toCsr - Compress a vector-of-vectors matrix into CSR form
+ * @matrix: The dense input matrix
+ */
+CsrMatrix toCsr(const std::vector<std::vector<int>>& matrix) {
+    return toCsr(Matrix<int>::fromVectors(matrix));
+}
+
+/**
+ * toDense - Expand a CSR matrix back into a dense Matrix<int>
+ * @sparse: The CSR input matrix
+ */
+Matrix<int> toDense(const CsrMatrix& sparse) {
+    Matrix<int> dense(sparse.rows, sparse.cols);
+    for (int i = 0; i < sparse.rows; i++) {
+        for (int k = sparse.rowPtr[i]; k < sparse.rowPtr[i + 1]; k++) {
+            dense(i, sparse.colIdx[k]) = sparse.values[k];
+        }
+    }
+    return dense;
+}
+
+/**
+ * transposeSparse - Transpose a CSR matrix
+ * @sparse: The CSR input matrix
+ *
+ * Counts the non-zeros per column, turns the counts into offsets and then
+ * scatters each entry into its column's slot. Visiting the rows in order
+ * keeps the row indices of every column sorted.
+ *
+ * Returns: The transpose, in CSR form
+ */
+CsrMatrix transposeSparse(const CsrMatrix& sparse) {
+    CsrMatrix result;
+    result.rows = sparse.cols;
+    result.cols = sparse.rows;
+    result.rowPtr.assign(sparse.cols + 1, 0);
+    result.colIdx.resize(sparse.nonZeros());
+    result.values.resize(sparse.nonZeros());
+
+    for (int c : sparse.colIdx) {
+        result.rowPtr[c + 1]++;
+    }
+    for (int j = 0; j < sparse.cols; j++) {
+        result.rowPtr[j + 1] += result.rowPtr[j];
+    }
+
+    std::vector<int> next(result.rowPtr.begin(), result.rowPtr.end() - 1);
+    for (int i = 0; i < sparse.rows; i++) {
+        for (int k = sparse.rowPtr[i]; k < sparse.rowPtr[i + 1]; k++) {
+            int slot = next[sparse.colIdx[k]]++;
+            result.colIdx[slot] = i;
+            result.values[slot] = sparse.values[k];
+        }
+    }
+    return result;
+}
+
+/**
+ * toCsc - Convert a CSR matrix to CSC form
+ * @sparse: The CSR input matrix
+ *
+ * The CSC arrays of a matrix are exactly the CSR arrays of its transpose.
+ */
+CscMatrix toCsc(const CsrMatrix& sparse) {
+    CsrMatrix t = transposeSparse(sparse);
+    CscMatrix result;
+    result.rows = sparse.rows;
+    result.cols = sparse.cols;
+    result.colPtr = std::move(t.rowPtr);
+    result.rowIdx = std::move(t.colIdx);
+    result.values = std::move(t.values);
+    return result;
+}
+
+/**
+ * toCsr - Convert a CSC matrix back to CSR form
+ * @sparse: The CSC input matrix
+ */
+CsrMatrix toCsr(const CscMatrix& sparse) {
+    CsrMatrix t;
+    t.rows = sparse.cols;
+    t.cols = sparse.rows;
+    t.rowPtr = sparse.colPtr;
+    t.colIdx = sparse.rowIdx;
+    t.values = sparse.values;
+    return transposeSparse(t);
+}
+
+/**
+ * partitionRows - Split the rows into ranges holding similar amounts of work
+ * @rowPtr: CSR row offsets; the work of a row is its non-zeros plus one
+ * @rows: Number of rows
+ * @numThreads: Requested number of ranges (0 = one per hardware thread)
+ *
+ * Small matrices get a single range so they stay on the calling thread.
+ *
+ * Returns: Non-empty [begin, end) row ranges covering all rows, in order
+ */
+static std::vector<std::pair<int, int>> partitionRows(const std::vector<int>& rowPtr, int rows,
+                                                      unsigned numThreads) {
+    const long long minWorkPerThread = 1 << 15;
+    long long work = (long long)rowPtr[rows] + rows;
+
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = (unsigned)std::min<long long>(numThreads, std::max<long long>(1, work / minWorkPerThread));
+
+    std::vector<std::pair<int, int>> ranges;
+    int begin = 0;
+    for (unsigned t = 1; t <= numThreads && begin < rows; t++) {
+        int end = rows;
+        if (t < numThreads) {
+            // First row whose cumulative work reaches t / numThreads of the total
+            long long target = work * t / numThreads;
+            int lo = begin, hi = rows;
+            while (lo < hi) {
+                int mid = lo + (hi - lo) / 2;
+                if ((long long)rowPtr[mid] + mid < target) lo = mid + 1;
+                else hi = mid;
+            }
+            end = lo;
+        }
+        if (end > begin) {
+            ranges.push_back({begin, end});
+        }
+        begin = end;
+    }
+    return ranges;
+}
+
+/**
+ * parallelRanges - Run fn(index, begin, end) for every range, one thread each
+ * @ranges: Row ranges from partitionRows
+ * @fn: Callable processing one range
+ */
+template <typename Fn>
+static void parallelRanges(const std::vector<std::pair<int, int>>& ranges, Fn fn) {
+    if (ranges.size() == 1) {
+        fn(0, ranges[0].first, ranges[0].second);
+        return;
+    }
+    std::vector<std::thread> workers;
+    for (size_t p = 0; p < ranges.size(); p++) {
+        workers.emplace_back(fn, p, ranges[p].first, ranges[p].second);
+    }
+    for (auto& w : workers) w.join();
+}
+
+/**
+ * multiplySparseVector - SpMV, y = A × x
+ * @sparse: The CSR matrix A
+ * @x: Dense vector with A.cols elements
+ * @numThreads: Number of worker threads (0 = one per hardware thread)
+ *
+ * Returns: The dense result vector with A.rows elements
+ */
+std::vector<int> multiplySparseVector(const CsrMatrix& sparse, const std::vector<int>& x,
+                                      unsigned numThreads = 0) {
+    if ((int)x.size() != sparse.cols) {
+        throw std::invalid_argument("Vector length must equal the number of matrix columns");
+    }
+
+    std::vector<int> y(sparse.rows, 0);
+    parallelRanges(partitionRows(sparse.rowPtr, sparse.rows, numThreads), [&](size_t, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            int sum = 0;
+            for (int k = sparse.rowPtr[i]; k < sparse.rowPtr[i + 1]; k++) {
+                sum += sparse.values[k] * x[sparse.colIdx[k]];
+            }
+            y[i] = sum;
+        }
+    });
+    return y;
+}
+
+/**
+ * multiplySparseDense - SpMM, C = A × B with A sparse and B dense
+ * @sparse: The CSR matrix A
+ * @dense: Dense matrix B with A.cols rows
+ * @numThreads: Number of worker threads (0 = one per hardware thread)
+ *
+ * Row i of C is a sum of rows of B scaled by the non-zeros of row i of A,
+ * so all accesses to B and C are unit-stride.
+ *
+ * Returns: The dense product
+ */
+Matrix<int> multiplySparseDense(const CsrMatrix& sparse, MatrixView<const int> dense,
+                                unsigned numThreads = 0) {
+    if (dense.rows() != sparse.cols) {
+        throw std::invalid_argument("Matrix multiplication not possible. Number of columns in first matrix must equal number of rows in second matrix.");
+    }
+
+    Matrix<int> result(sparse.rows, dense.cols());
+    int n = dense.cols();
+    parallelRanges(partitionRows(sparse.rowPtr, sparse.rows, numThreads), [&](size_t, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            int* out = result.row(i);
+            for (int k = sparse.rowPtr[i]; k < sparse.rowPtr[i + 1]; k++) {
+                int a = sparse.values[k];
+                const int* b = dense.row(sparse.colIdx[k]);
+                for (int j = 0; j < n; j++) {
+                    out[j] += a * b[j];
+                }
+            }
+        }
+    });
+    return result;
+}
+
+/**
+ * multiplySparse - SpGEMM, C = A × B with both operands sparse (Gustavson)
+ * @a: The CSR matrix A
+ * @b: The CSR matrix B with A.cols rows
+ * @numThreads: Number of worker threads (0 = one per hardware thread)
+ *
+ * Each thread builds its rows of C with a dense accumulator of B.cols values
+ * plus the list of columns touched, then the per-thread pieces are
+ * concatenated in row order.
+ *
+ * Returns: The sparse product in CSR form
+ */
+CsrMatrix multiplySparse(const CsrMatrix& a, const CsrMatrix& b, unsigned numThreads = 0) {
+    if (a.cols != b.rows) {
+        throw std::invalid_argument("Matrix multiplication not possible. Number of columns in first matrix must equal number of rows in second matrix.");
+    }
+
+    struct Piece {
+        std::vector<int> rowNnz, colIdx, values;
+    };
+    std::vector<std::pair<int, int>> ranges = partitionRows(a.rowPtr, a.rows, numThreads);
+    std::vector<Piece> pieces(ranges.size());
+
+    parallelRanges(ranges, [&](size_t p, int begin, int end) {
+        Piece& piece = pieces[p];
+        std::vector<int> accumulator(b.cols, 0);
+        std::vector<char> touched(b.cols, 0);
+        std::vector<int> columns;
+
+        for (int i = begin; i < end; i++) {
+            columns.clear();
+            for (int ka = a.rowPtr[i]; ka < a.rowPtr[i + 1]; ka++) {
+                int av = a.values[ka];
+                int r = a.colIdx[ka];
+                for (int kb = b.rowPtr[r]; kb < b.rowPtr[r + 1]; kb++) {
+                    int c = b.colIdx[kb];
+                    if (!touched[c]) {
+                        touched[c] = 1;
+                        columns.push_back(c);
+                    }
+                    accumulator[c] += av * b.values[kb];
+                }
+            }
+
+            std::sort(columns.begin(), columns.end());
+            int count = 0;
+            for (int c : columns) {
+                if (accumulator[c] != 0) {
+                    piece.colIdx.push_back(c);
+                    piece.values.push_back(accumulator[c]);
+                    count++;
+                }
+                accumulator[c] = 0;
+                touched[c] = 0;
+            }
+            piece.rowNnz.push_back(count);
+        }
+    });
+
+    CsrMatrix result;
+    result.rows = a.rows;
+    result.cols = b.cols;
+    result.rowPtr.assign(1, 0);
+    result.rowPtr.reserve(a.rows + 1);
+    for (const Piece& piece : pieces) {
+        for (int count : piece.rowNnz) result.rowPtr.push_back(result.rowPtr.back() + count);
+        result.colIdx.insert(result.colIdx.end(), piece.colIdx.begin(), piece.colIdx.end());
+        result.values.insert(result.values.end(), piece.values.begin(), piece.values.end());
+    }
+    return result;
+}
+
+/**
+ * addSparse - Add two CSR matrices
+ * @a: The first input matrix
+ * @b: The second input matrix
+ *
+ * Each pair of rows is merged like two sorted lists; entries that cancel out
+ * are dropped.
+ *
+ * Returns: The sum in CSR form
+ */
+CsrMatrix addSparse(const CsrMatrix& a, const CsrMatrix& b) {
+    if (a.rows != b.rows || a.cols != b.cols) {
+        throw std::invalid_argument("Matrices must have the same dimensions for addition");
+    }
+
+    CsrMatrix result;
+    result.rows = a.rows;
+    result.cols = a.cols;
+    result.rowPtr.assign(1, 0);
+    result.colIdx.reserve(a.nonZeros() + b.nonZeros());
+    result.values.reserve(a.nonZeros() + b.nonZeros());
+
+    auto emit = [&](int col, int value) {
+        if (value != 0) {
+            result.colIdx.push_back(col);
+            result.values.push_back(value);
+        }
+    };
+
+    for (int i = 0; i < a.rows; i++) {
+        int ka = a.rowPtr[i], endA = a.rowPtr[i + 1];
+        int kb = b.rowPtr[i], endB = b.rowPtr[i + 1];
+        while (ka < endA && kb < endB) {
+            if (a.colIdx[ka] < b.colIdx[kb]) {
+                emit(a.colIdx[ka], a.values[ka]);
+                ka++;
+            } else if (a.colIdx[ka] > b.colIdx[kb]) {
+                emit(b.colIdx[kb], b.values[kb]);
+                kb++;
+            } else {
+                emit(a.colIdx[ka], a.values[ka] + b.values[kb]);
+                ka++;
+                kb++;
+            }
+        }
+        for (; ka < endA; ka++) emit(a.colIdx[ka], a.values[ka]);
+        for (; kb < endB; kb++) emit(b.colIdx[kb], b.values[kb]);
+        result.rowPtr.push_back((int)result.values.size());
+    }
+    return result;
+}
+
+/**
+ * isSymmetricSparse - Check if a CSR matrix is symmetric
+ * @sparse: The CSR input matrix
+ *
+ * A matrix is symmetric exactly when its CSR arrays equal those of its
+ * transpose, since both are stored in the same canonical order.
+ *
+ * Returns: true if the matrix is symmetric, false otherwise
+ */
+bool isSymmetricSparse(const CsrMatrix& sparse) {
+    if (sparse.rows != sparse.cols) {
+        return false;
+    }
+    CsrMatrix t = transposeSparse(sparse);
+    return t.rowPtr == sparse.rowPtr && t.colIdx == sparse.colIdx && t.values == sparse.values;
+}
+
+/**
+ * printCsr - Print the arrays of a CSR matrix
+ * @sparse: The CSR matrix
+ */
+void printCsr(const CsrMatrix& sparse) {
+    auto printArray = [](const char* name, const std::vector<int>& values) {
+        std::cout << name << ": [ ";
+        for (int v : values) std::cout << v << " ";
+        std::cout << "]" << std::endl;
+    };
+    std::cout << sparse.rows << "x" << sparse.cols << ", " << sparse.nonZeros() << " non-zeros" << std::endl;
+    printArray("rowPtr", sparse.rowPtr);
+    printArray("colIdx", sparse.colIdx);
+    printArray("values", sparse.values);
+}
+
+/**
+ * printMatrix - Print a contiguous matrix or matrix view
+ * @matrix: The matrix to print
+ */
+void printMatrix(MatrixView<const int> matrix) {
+    for (int i = 0; i < matrix.rows(); i++) {
+        for (int j = 0; j < matrix.cols(); j++) {
+            std::cout << matrix(i, j) << "\t";
+        }
+        std::cout << std::endl;
+    }
+}
+
+/**
+ * benchmarkSparse - Compare sparse and dense kernels across densities
+ * @n: Dimension of the square test matrices
+ *
+ * For each density prints the time of matrix-vector product, matrix-matrix
+ * product (n/8 dense columns) and addition, dense versus sparse, which shows
+ * the density below which the sparse form wins.
+ */
+void benchmarkSparse(int n) {
+    std::mt19937 rng(5);
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    int k = std::max(1, n / 8);
+    Matrix<int> rhs(n, k, 1);
+    std::vector<int> x(n, 1);
+
+    std::cout << "n = " << n << ", times in ms (dense / sparse)" << std::endl;
+    std::cout << "density\tSpMV\t\t\tSpMM (n x " << k << ")\t\tadd" << std::endl;
+    for (double density : {0.0001, 0.001, 0.01, 0.05, 0.1, 0.3}) {
+        std::bernoulli_distribution keep(density);
+        Matrix<int> a(n, n), b(n, n);
+        for (size_t e = 0; e < a.size(); e++) {
+            if (keep(rng)) a.data()[e] = 1 + (int)(rng() % 9);
+            if (keep(rng)) b.data()[e] = 1 + (int)(rng() % 9);
+        }
+        CsrMatrix sa = toCsr(a), sb = toCsr(b);
+
+        std::vector<int> yDense(n), ySparse;
+        double tMvDense = timeIt([&] {
+            for (int i = 0; i < n; i++) {
+                int sum = 0;
+                const int* row = a.row(i);
+                for (int j = 0; j < n; j++) sum += row[j] * x[j];
+                yDense[i] = sum;
+            }
+        });
+        double tMvSparse = timeIt([&] { ySparse = multiplySparseVector(sa, x); });
+
+        Matrix<int> cDense(n, k), cSparse;
+        double tMmDense = timeIt([&] {
+            for (int i = 0; i < n; i++) {
+                int* out = cDense.row(i);
+                for (int p = 0; p < n; p++) {
+                    int av = a(i, p);
+                    const int* row = rhs.row(p);
+                    for (int j = 0; j < k; j++) out[j] += av * row[j];
+                }
+            }
+        });
+        double tMmSparse = timeIt([&] { cSparse = multiplySparseDense(sa, rhs); });
+
+        Matrix<int> sumDense(n, n);
+        CsrMatrix sumSparse;
+        double tAddDense = timeIt([&] {
+            for (size_t e = 0; e < a.size(); e++) sumDense.data()[e] = a.data()[e] + b.data()[e];
+        });
+        double tAddSparse = timeIt([&] { sumSparse = addSparse(sa, sb); });
+
+        bool ok = yDense == ySparse && cDense == cSparse && toDense(sumSparse) == sumDense;
+        std::cout << density << "\t" << tMvDense << " / " << tMvSparse << "\t"
+                  << tMmDense << " / " << tMmSparse << "\t"
+                  << tAddDense << " / " << tAddSparse << (ok ? "" : "  (MISMATCH)") << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkSparse(argc > 2 ? std::stoi(argv[2]) : 2000);
+        return 0;
+    }
+
+    // Example 1: Converting a mostly-zero matrix
+    std::vector<std::vector<int>> dense = {
+        {5, 0, 0, 0},
+        {0, 8, 0, 0},
+        {0, 0, 3, 0},
+        {0, 6, 0, 0}
+    };
+
+    CsrMatrix a = toCsr(dense);
+    std::cout << "Example 1: CSR form of a 4x4 matrix" << std::endl;
+    printCsr(a);
+
+    CscMatrix ac = toCsc(a);
+    std::cout << "\nCSC form: colPtr = [ ";
+    for (int v : ac.colPtr) std::cout << v << " ";
+    std::cout << "], rowIdx = [ ";
+    for (int v : ac.rowIdx) std::cout << v << " ";
+    std::cout << "]" << std::endl;
+
+    // Example 2: Transpose and symmetry
+    std::cout << "\nExample 2: Transpose" << std::endl;
+    printMatrix(toDense(transposeSparse(a)));
+    std::cout << "Symmetric: " << (isSymmetricSparse(a) ? "yes" : "no") << std::endl;
+
+    CsrMatrix sym = addSparse(a, transposeSparse(a));
+    std::cout << "\nA + A^T:" << std::endl;
+    printMatrix(toDense(sym));
+    std::cout << "Symmetric: " << (isSymmetricSparse(sym) ? "yes" : "no") << std::endl;
+
+    // Example 3: Products
+    std::cout << "\nExample 3: A x [1 2 3 4]" << std::endl;
+    for (int v : multiplySparseVector(a, {1, 2, 3, 4})) std::cout << v << " ";
+    std::cout << std::endl;
+
+    std::cout << "\nA x A (sparse x sparse):" << std::endl;
+    printMatrix(toDense(multiplySparse(a, a)));
+
+    // Example 4: Mismatched dimensions
+    try {
+        multiplySparseVector(a, {1, 2, 3});
+    } catch (const std::exception& e) {
+        std::cerr << "\nError: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
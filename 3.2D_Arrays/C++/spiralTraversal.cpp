@@ -11,6 +11,9 @@
  * 3. After each traversal, shrink the corresponding boundary
  * 4. Continue until all elements are visited
  * 
+ * For contiguous matrices, SpiralRange and SpiralCursor stream the spiral
+ * lazily (element by element, or in caller-sized chunks) in O(1) memory.
+ * 
  * Time Complexity: O(m×n) where m and n are the dimensions of the matrix
  * Space Complexity: O(1) for the traversal (O(m×n) if storing the result)
  * 
@@ -20,6 +23,11 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include "matrix.h"
 
 /**
  * spiralOrder - Traverse a matrix in spiral order
@@ -88,6 +96,208 @@ void printSpiralOrder(const std::vector<std::vector<int>>& matrix) {
     std::cout << std::endl;
 }
 
+/**
+ * SpiralRun - One straight edge of the spiral
+ * @first: Pointer to the first element of the run
+ * @length: Number of elements in the run
+ * @step: Distance in elements between consecutive elements of the run
+ *        (+1 right, +stride down, -1 left, -stride up)
+ */
+struct SpiralRun {
+    const int* first;
+    size_t length;
+    ptrdiff_t step;
+};
+
+/**
+ * SpiralCursor - Resumable spiral-order traversal of a matrix view
+ * 
+ * Holds only the four boundaries, the current side and a position inside the
+ * current run, so streaming a matrix of any size takes O(1) memory. Elements
+ * can be consumed one edge run at a time (nextRun) or copied out in chunks of
+ * any size (read), stopping and resuming at any point.
+ */
+class SpiralCursor {
+public:
+    explicit SpiralCursor(MatrixView<const int> matrix)
+        : matrix_(matrix), top_(0), bottom_(matrix.rows() - 1),
+          left_(0), right_(matrix.cols() - 1) {
+        if (matrix.empty()) {
+            top_ = 1;
+            bottom_ = 0;
+        }
+    }
+    
+    /**
+     * nextRun - Produce the next non-empty edge of the spiral
+     * @run: Receives the run
+     * 
+     * Follows the same boundary updates as spiralOrder above.
+     * 
+     * Returns: false once every element has been produced
+     */
+    bool nextRun(SpiralRun& run) {
+        ptrdiff_t stride = matrix_.stride();
+        for (;;) {
+            switch (side_) {
+                case 0: // Traverse right
+                    if (top_ > bottom_ || left_ > right_) return false;
+                    run = {&matrix_(top_, left_), (size_t)(right_ - left_ + 1), 1};
+                    top_++;
+                    side_ = 1;
+                    return true;
+                case 1: { // Traverse down
+                    side_ = 2;
+                    int col = right_--;
+                    if (top_ <= bottom_) {
+                        run = {&matrix_(top_, col), (size_t)(bottom_ - top_ + 1), stride};
+                        return true;
+                    }
+                    break;
+                }
+                case 2: // Traverse left (if there are still rows to traverse)
+                    side_ = 3;
+                    if (top_ <= bottom_) {
+                        int row = bottom_--;
+                        if (left_ <= right_) {
+                            run = {&matrix_(row, right_), (size_t)(right_ - left_ + 1), -1};
+                            return true;
+                        }
+                    }
+                    break;
+                case 3: // Traverse up (if there are still columns to traverse)
+                    side_ = 0;
+                    if (left_ <= right_) {
+                        int col = left_++;
+                        if (top_ <= bottom_) {
+                            run = {&matrix_(bottom_, col), (size_t)(bottom_ - top_ + 1), -stride};
+                            return true;
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+    
+    /**
+     * read - Copy up to maxCount of the next elements in spiral order
+     * @out: Destination buffer
+     * @maxCount: Capacity of @out
+     * 
+     * Rightward runs are contiguous and copied with memcpy, leftward runs with
+     * a reversed copy; vertical runs are strided and copied element by element.
+     * 
+     * Returns: The number of elements written (0 once the spiral is exhausted)
+     */
+    size_t read(int* out, size_t maxCount) {
+        size_t written = 0;
+        while (written < maxCount) {
+            if (offset_ == current_.length) {
+                if (!nextRun(current_)) break;
+                offset_ = 0;
+            }
+            size_t n = std::min(maxCount - written, current_.length - offset_);
+            const int* src = current_.first + (ptrdiff_t)offset_ * current_.step;
+            
+            if (current_.step == 1) {
+                std::memcpy(out + written, src, n * sizeof(int));
+            } else if (current_.step == -1) {
+                std::reverse_copy(src - (n - 1), src + 1, out + written);
+            } else {
+                for (size_t k = 0; k < n; k++) {
+                    out[written + k] = src[(ptrdiff_t)k * current_.step];
+                }
+            }
+            written += n;
+            offset_ += n;
+        }
+        return written;
+    }
+    
+private:
+    MatrixView<const int> matrix_;
+    int top_, bottom_, left_, right_;
+    int side_ = 0;
+    SpiralRun current_ = {nullptr, 0, 0};
+    size_t offset_ = 0;
+};
+
+/**
+ * SpiralRange - Lazy range over the elements of a matrix view in spiral order
+ * 
+ *     for (int value : SpiralRange(matrix)) { ... }
+ * 
+ * Nothing is materialised: the iterator walks the current edge run and asks
+ * a SpiralCursor for the next one when it runs out.
+ */
+class SpiralRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = int;
+        using difference_type = ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+        
+        iterator() = default;
+        explicit iterator(MatrixView<const int> matrix) : cursor_(matrix), atEnd_(false) {
+            advanceRun();
+        }
+        
+        reference operator*() const { return *current_; }
+        iterator& operator++() {
+            if (--remaining_ == 0) {
+                advanceRun();
+            } else {
+                current_ += run_.step;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(const iterator& other) const { return atEnd_ == other.atEnd_ && (atEnd_ || current_ == other.current_); }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+        
+    private:
+        void advanceRun() {
+            if (cursor_.nextRun(run_)) {
+                current_ = run_.first;
+                remaining_ = run_.length;
+            } else {
+                atEnd_ = true;
+            }
+        }
+        
+        SpiralCursor cursor_{MatrixView<const int>()};
+        SpiralRun run_ = {nullptr, 0, 0};
+        const int* current_ = nullptr;
+        size_t remaining_ = 0;
+        bool atEnd_ = true;
+    };
+    
+    explicit SpiralRange(MatrixView<const int> matrix) : matrix_(matrix) {}
+    iterator begin() const { return iterator(matrix_); }
+    iterator end() const { return iterator(); }
+    
+private:
+    MatrixView<const int> matrix_;
+};
+
+/**
+ * spiralOrder - Traverse a contiguous matrix (or matrix view) in spiral order
+ * @matrix: The input matrix
+ * 
+ * Fills the result with SpiralCursor::read, i.e. one block copy per edge.
+ * 
+ * Returns: A vector containing the elements in spiral order
+ */
+std::vector<int> spiralOrder(MatrixView<const int> matrix) {
+    std::vector<int> result((size_t)matrix.rows() * matrix.cols());
+    SpiralCursor cursor(matrix);
+    cursor.read(result.data(), result.size());
+    return result;
+}
+
 /**
  * printMatrix - Print a matrix
  * @matrix: The matrix to print
@@ -103,6 +313,19 @@ void printMatrix(const std::vector<std::vector<int>>& matrix) {
     }
 }
 
+/**
+ * printMatrix - Print a contiguous matrix or matrix view
+ * @matrix: The matrix to print
+ */
+void printMatrix(MatrixView<const int> matrix) {
+    for (int i = 0; i < matrix.rows(); i++) {
+        for (int j = 0; j < matrix.cols(); j++) {
+            std::cout << matrix(i, j) << "\t";
+        }
+        std::cout << std::endl;
+    }
+}
+
 int main() {
     // Example 1: Square matrix
     std::vector<std::vector<int>> matrix1 = {
@@ -163,5 +386,37 @@ int main() {
     printMatrix(matrix5);
     printSpiralOrder(matrix5);
     
+    // Example 6: Contiguous matrix and a submatrix view
+    Matrix<int> flat = Matrix<int>::fromVectors(matrix2);
+    
+    std::cout << "\nExample 6: Inner 2x2 block of the 4x3 Matrix<int>" << std::endl;
+    MatrixView<const int> inner = flat.view().block(1, 0, 2, 2);
+    printMatrix(inner);
+    std::cout << "Spiral Order: ";
+    for (int val : spiralOrder(inner)) {
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+    
+    // Example 7: Streaming the spiral without materialising it
+    std::cout << "\nExample 7: First 7 spiral elements of the 4x3 Matrix<int>, streamed lazily" << std::endl;
+    int taken = 0;
+    for (int val : SpiralRange(flat)) {
+        if (taken++ == 7) break;
+        std::cout << val << " ";
+    }
+    std::cout << std::endl;
+    
+    std::cout << "Same matrix read in chunks of 5:" << std::endl;
+    SpiralCursor cursor(flat);
+    int chunk[5];
+    size_t got;
+    while ((got = cursor.read(chunk, 5)) > 0) {
+        std::cout << "[ ";
+        for (size_t k = 0; k < got; k++) std::cout << chunk[k] << " ";
+        std::cout << "] ";
+    }
+    std::cout << std::endl;
+    
     return 0;
 }
\ No newline at end of file
@@ -4,12 +4,26 @@
  * This program demonstrates how to check if a matrix is symmetric in C++.
  * A symmetric matrix is a square matrix that is equal to its transpose.
  * 
+ * For large contiguous matrices, isSymmetricTiled compares each 8×8 tile of
+ * the upper triangle with its mirror tile (AVX2 when built with -mavx2) and
+ * stops at the first mismatch; isSymmetricApprox does the same with a
+ * tolerance for floating-point elements.
+ * Benchmark: ./symmetricMatrix --bench [n]
+ * 
  * Time Complexity: O(n²) where n is the dimension of the matrix
  * Space Complexity: O(1) as we only need a few variables
  */
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include "matrix.h"
+#include "transpose.h"
 
 /**
  * isSymmetric - Check if a matrix is symmetric
@@ -82,6 +96,231 @@ bool isSymmetricOptimized(const std::vector<std::vector<int>>& matrix) {
     return true;
 }
 
+/**
+ * isSymmetric - Check if a contiguous matrix (or view) is symmetric
+ * @matrix: The input matrix
+ * 
+ * Returns: true if the matrix is symmetric, false otherwise
+ */
+bool isSymmetric(MatrixView<const int> matrix) {
+    if (matrix.empty()) {
+        return true; // Empty matrix is considered symmetric
+    }
+    if (!matrix.isSquare()) {
+        return false; // Not a square matrix
+    }
+    
+    int size = matrix.rows();
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            if (matrix(i, j) != matrix(j, i)) {
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+// Tiles of SYMMETRY_TILE × SYMMETRY_TILE elements are visited together so a
+// block and its mirror block both stay in L1 while they are compared
+constexpr int SYMMETRY_TILE = 32;
+
+/**
+ * symmetricScan - Walk the upper triangle in tiles, comparing with the mirror
+ * @matrix: The square input matrix
+ * @equal: Scalar predicate equal(a(i, j), a(j, i))
+ * @tileEqual: Predicate for a full 8×8 tile at (i, j) against its mirror at (j, i)
+ * 
+ * Returns: false as soon as one pair differs
+ */
+template <typename T, typename Equal, typename TileEqual>
+static bool symmetricScan(MatrixView<const T> matrix, Equal equal, TileEqual tileEqual) {
+    int n = matrix.rows();
+    for (int ib = 0; ib < n; ib += SYMMETRY_TILE) {
+        int iEnd = std::min(ib + SYMMETRY_TILE, n);
+        for (int jb = ib; jb < n; jb += SYMMETRY_TILE) {
+            int jEnd = std::min(jb + SYMMETRY_TILE, n);
+            
+            for (int i0 = ib; i0 < iEnd; i0 += 8) {
+                for (int j0 = std::max(jb, i0); j0 < jEnd; j0 += 8) {
+                    if (i0 + 8 <= n && j0 + 8 <= n) {
+                        if (!tileEqual(i0, j0)) return false;
+                        continue;
+                    }
+                    // Partial tile on the matrix edge. The diagonal is included, as
+                    // in the full tiles, so a NaN there is a mismatch at any size
+                    for (int i = i0; i < std::min(i0 + 8, n); i++) {
+                        for (int j = std::max(j0, i); j < std::min(j0 + 8, n); j++) {
+                            if (!equal(matrix(i, j), matrix(j, i))) return false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * isSymmetricTiled - Tiled, early-exit exact symmetry check
+ * @matrix: The input matrix (or view)
+ * 
+ * Each 8×8 tile of the upper triangle is compared with its mirror tile. For
+ * 32-bit element types with AVX2 the mirror tile is loaded row by row,
+ * transposed in registers (transpose.h) and compared 8 lanes at a time, so
+ * neither tile is ever read down a column.
+ * 
+ * Returns: true if the matrix is symmetric, false at the first mismatch
+ */
+template <typename T>
+bool isSymmetricTiled(MatrixView<const T> matrix) {
+    if (matrix.empty()) return true;
+    if (!matrix.isSquare()) return false;
+    
+    auto equal = [](const T& a, const T& b) { return a == b; };
+    
+#if defined(__AVX2__)
+    if constexpr (sizeof(T) == 4 && std::is_integral<T>::value) {
+        size_t strideBytes = (size_t)matrix.stride() * sizeof(T);
+        return symmetricScan(matrix, equal, [&](int i, int j) {
+            __m256i a[8], b[8];
+            transpose_detail::load8x8(&matrix(i, j), strideBytes, a);
+            transpose_detail::load8x8(&matrix(j, i), strideBytes, b);
+            transpose_detail::transposeRegs8x8(b);
+            __m256i same = _mm256_cmpeq_epi32(a[0], b[0]);
+            for (int k = 1; k < 8; k++) {
+                same = _mm256_and_si256(same, _mm256_cmpeq_epi32(a[k], b[k]));
+            }
+            return _mm256_movemask_epi8(same) == -1;
+        });
+    }
+#endif
+    return symmetricScan(matrix, equal, [&](int i, int j) {
+        for (int r = 0; r < 8; r++) {
+            const T* row = &matrix(i + r, j);
+            for (int c = 0; c < 8; c++) {
+                if (!(row[c] == matrix(j + c, i + r))) return false;
+            }
+        }
+        return true;
+    });
+}
+
+/**
+ * isSymmetricApprox - Tiled symmetry check with a floating-point tolerance
+ * @matrix: The input matrix (or view) of float or double
+ * @absTol: Absolute tolerance
+ * @relTol: Relative tolerance, scaled by the larger magnitude of the pair
+ * 
+ * a(i, j) and a(j, i) match when they are equal or when |a - b| is finite and
+ * <= absTol + relTol × max(|a|, |b|). Equal infinities match (their difference
+ * is NaN), an infinity never matches anything else, and NaN never matches,
+ * not even on the diagonal. For float with AVX2 the comparison is done on whole
+ * 8×8 tiles in registers, like isSymmetricTiled.
+ * 
+ * Returns: true if the matrix is symmetric within the tolerance
+ */
+template <typename T>
+bool isSymmetricApprox(MatrixView<const T> matrix, T absTol, T relTol = T(0)) {
+    static_assert(std::is_floating_point<T>::value, "isSymmetricApprox needs a floating-point type");
+    if (matrix.empty()) return true;
+    if (!matrix.isSquare()) return false;
+    
+    const T inf = std::numeric_limits<T>::infinity();
+    auto equal = [=](T a, T b) {
+        T diff = std::fabs(a - b);
+        return a == b || (diff < inf && diff <= absTol + relTol * std::max(std::fabs(a), std::fabs(b)));
+    };
+    
+#if defined(__AVX2__)
+    if constexpr (std::is_same<T, float>::value) {
+        size_t strideBytes = (size_t)matrix.stride() * sizeof(T);
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        const __m256 vAbs = _mm256_set1_ps(absTol);
+        const __m256 vRel = _mm256_set1_ps(relTol);
+        const __m256 vInf = _mm256_set1_ps(inf);
+        return symmetricScan(matrix, equal, [&](int i, int j) {
+            __m256i a[8], b[8];
+            transpose_detail::load8x8(&matrix(i, j), strideBytes, a);
+            transpose_detail::load8x8(&matrix(j, i), strideBytes, b);
+            transpose_detail::transposeRegs8x8(b);
+            for (int k = 0; k < 8; k++) {
+                __m256 x = _mm256_castsi256_ps(a[k]);
+                __m256 y = _mm256_castsi256_ps(b[k]);
+                __m256 diff = _mm256_andnot_ps(signMask, _mm256_sub_ps(x, y));
+                __m256 scale = _mm256_max_ps(_mm256_andnot_ps(signMask, x), _mm256_andnot_ps(signMask, y));
+                __m256 limit = _mm256_add_ps(vAbs, _mm256_mul_ps(vRel, scale));
+                __m256 close = _mm256_and_ps(_mm256_cmp_ps(diff, limit, _CMP_LE_OQ),
+                                             _mm256_cmp_ps(diff, vInf, _CMP_LT_OQ));
+                __m256 match = _mm256_or_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ), close);
+                if (_mm256_movemask_ps(match) != 0xFF) return false;
+            }
+            return true;
+        });
+    }
+#endif
+    return symmetricScan(matrix, equal, [&](int i, int j) {
+        for (int r = 0; r < 8; r++) {
+            const T* row = &matrix(i + r, j);
+            for (int c = 0; c < 8; c++) {
+                if (!equal(row[c], matrix(j + c, i + r))) return false;
+            }
+        }
+        return true;
+    });
+}
+
+/**
+ * isSymmetricOptimized - Check if a contiguous matrix (or view) is symmetric
+ * @matrix: The input matrix
+ * 
+ * Uses the tiled, early-exit comparison above.
+ * 
+ * Returns: true if the matrix is symmetric, false otherwise
+ */
+bool isSymmetricOptimized(MatrixView<const int> matrix) {
+    return isSymmetricTiled(matrix);
+}
+
+/**
+ * benchmarkSymmetry - Time the symmetry checks on an n×n symmetric matrix
+ * @n: Matrix dimension
+ * 
+ * A symmetric input is the worst case: every pair has to be compared.
+ */
+void benchmarkSymmetry(int n) {
+    Matrix<int> flat(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) {
+            flat(i, j) = flat(j, i) = (i * 31 + j * 17) % 1000;
+        }
+    }
+    std::vector<std::vector<int>> nested = flat.toVectors();
+    Matrix<float> covariance(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) {
+            covariance(i, j) = covariance(j, i) = 1.0f / (1 + i + j);
+        }
+    }
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        bool result = fn();
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(ms, result);
+    };
+    
+    auto naive = timeIt([&] { return isSymmetricOptimized(nested); });
+    auto tiled = timeIt([&] { return isSymmetricTiled<int>(flat); });
+    auto approx = timeIt([&] { return isSymmetricApprox<float>(covariance, 1e-6f, 1e-5f); });
+    
+    std::cout << "n = " << n << std::endl;
+    std::cout << "  vector-of-vectors upper triangle: " << naive.first << " ms (" << naive.second << ")" << std::endl;
+    std::cout << "  tiled Matrix<int>:                " << tiled.first << " ms (" << tiled.second << ")" << std::endl;
+    std::cout << "  tiled Matrix<float> with tolerance: " << approx.first << " ms (" << approx.second << ")" << std::endl;
+}
+
 /**
  * printMatrix - Print a matrix
  * @matrix: The matrix to print
@@ -97,7 +336,12 @@ void printMatrix(const std::vector<std::vector<int>>& matrix) {
     }
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkSymmetry(argc > 2 ? std::stoi(argv[2]) : 4096);
+        return 0;
+    }
+    
     // Example 1: Symmetric matrix
     std::vector<std::vector<int>> symmetric = {
         {1, 2, 3},
@@ -167,5 +411,24 @@ int main() {
     std::cout << "For large matrices, the optimized version is more efficient" << std::endl;
     std::cout << "as it only checks the upper triangular part." << std::endl;
     
+    // Example 5: Contiguous matrix and a submatrix view
+    Matrix<int> flat = Matrix<int>::fromVectors(symmetric2);
+    
+    std::cout << "\nExample 5: Contiguous Matrix<int> storage" << std::endl;
+    std::cout << "Whole 4x4 matrix symmetric: " << (isSymmetricOptimized(flat) ? "yes" : "no") << std::endl;
+    std::cout << "Top-left 2x2 block symmetric: " << (isSymmetric(flat.block(0, 0, 2, 2)) ? "yes" : "no") << std::endl;
+    std::cout << "Top-right 2x2 block symmetric: " << (isSymmetric(flat.block(0, 2, 2, 2)) ? "yes" : "no") << std::endl;
+    
+    // Example 6: Floating-point matrix with rounding noise
+    Matrix<double> noisy = {
+        {1.0, 0.1 + 0.2, 2.5},
+        {0.3, 4.0, -1.0},
+        {2.5, -1.0 + 1e-12, 9.0}
+    };
+    
+    std::cout << "\nExample 6: Floating-point matrix with rounding noise" << std::endl;
+    std::cout << "Exact check:           " << (isSymmetricTiled<double>(noisy) ? "symmetric" : "not symmetric") << std::endl;
+    std::cout << "Tolerance 1e-9 check:  " << (isSymmetricApprox<double>(noisy, 1e-9) ? "symmetric" : "not symmetric") << std::endl;
+    
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,272 @@
+/**
+ * Cache-Oblivious Blocked Transpose
+ *
+ * Transposing element by element reads one matrix along rows and the other
+ * along columns; once a column no longer fits in the cache (or its pages no
+ * longer fit in the TLB) every access misses.
+ *
+ * These routines split the matrix recursively along its larger dimension
+ * until a block is at most TRANSPOSE_TILE × TRANSPOSE_TILE, so at every level
+ * of the memory hierarchy some recursion level fits, without tuning for a
+ * particular cache size. The leaves are walked in 8×8 tiles; for 32-bit
+ * element types with AVX2 enabled (-mavx2 / -march=native) an 8×8 tile is
+ * transposed entirely in registers.
+ *
+ * Time Complexity: O(m×n)
+ * Space Complexity: O(log(m+n)) recursion depth
+ */
+
+#ifndef TRANSPOSE_H
+#define TRANSPOSE_H
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "matrix.h"
+
+// Recursion stops once both dimensions are at most this many elements
+constexpr int TRANSPOSE_TILE = 32;
+
+namespace transpose_detail {
+
+#if defined(__AVX2__)
+/**
+ * transposeRegs8x8 - Transpose eight 8-lane rows of 32-bit values in registers
+ * @r: The rows; on return r[k] holds column k
+ */
+inline void transposeRegs8x8(__m256i r[8]) {
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+    __m256i s0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i s1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i s2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i s3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i s4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i s5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i s6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i s7 = _mm256_unpackhi_epi64(t5, t7);
+
+    r[0] = _mm256_permute2x128_si256(s0, s4, 0x20);
+    r[1] = _mm256_permute2x128_si256(s1, s5, 0x20);
+    r[2] = _mm256_permute2x128_si256(s2, s6, 0x20);
+    r[3] = _mm256_permute2x128_si256(s3, s7, 0x20);
+    r[4] = _mm256_permute2x128_si256(s0, s4, 0x31);
+    r[5] = _mm256_permute2x128_si256(s1, s5, 0x31);
+    r[6] = _mm256_permute2x128_si256(s2, s6, 0x31);
+    r[7] = _mm256_permute2x128_si256(s3, s7, 0x31);
+}
+
+inline void load8x8(const void* src, size_t stride, __m256i r[8]) {
+    const char* p = static_cast<const char*>(src);
+    for (int k = 0; k < 8; k++) r[k] = _mm256_loadu_si256((const __m256i*)(p + k * stride));
+}
+
+inline void store8x8(void* dst, size_t stride, const __m256i r[8]) {
+    char* p = static_cast<char*>(dst);
+    for (int k = 0; k < 8; k++) _mm256_storeu_si256((__m256i*)(p + k * stride), r[k]);
+}
+#endif
+
+template <typename T>
+constexpr bool useSimd8x8() {
+#if defined(__AVX2__)
+    return sizeof(T) == 4 && std::is_trivially_copyable<T>::value;
+#else
+    return false;
+#endif
+}
+
+/**
+ * copyTile8x8 - dst = src^T for one full 8×8 tile (strides in elements)
+ */
+template <typename T>
+inline void copyTile8x8(const T* src, size_t ss, T* dst, size_t ds) {
+#if defined(__AVX2__)
+    if constexpr (useSimd8x8<T>()) {
+        __m256i r[8];
+        load8x8(src, ss * sizeof(T), r);
+        transposeRegs8x8(r);
+        store8x8(dst, ds * sizeof(T), r);
+        return;
+    }
+#endif
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++) dst[j * ds + i] = src[i * ss + j];
+}
+
+/**
+ * swapTile8x8 - Exchange tile x with tile y^T (both 8×8, same stride)
+ */
+template <typename T>
+inline void swapTile8x8(T* x, T* y, size_t s) {
+#if defined(__AVX2__)
+    if constexpr (useSimd8x8<T>()) {
+        __m256i rx[8], ry[8];
+        load8x8(x, s * sizeof(T), rx);
+        load8x8(y, s * sizeof(T), ry);
+        transposeRegs8x8(rx);
+        transposeRegs8x8(ry);
+        store8x8(x, s * sizeof(T), ry);
+        store8x8(y, s * sizeof(T), rx);
+        return;
+    }
+#endif
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++) std::swap(x[i * s + j], y[j * s + i]);
+}
+
+/**
+ * transposeDiagTile8x8 - Transpose one 8×8 tile on the diagonal in place
+ */
+template <typename T>
+inline void transposeDiagTile8x8(T* a, size_t s) {
+#if defined(__AVX2__)
+    if constexpr (useSimd8x8<T>()) {
+        __m256i r[8];
+        load8x8(a, s * sizeof(T), r);
+        transposeRegs8x8(r);
+        store8x8(a, s * sizeof(T), r);
+        return;
+    }
+#endif
+    for (int i = 0; i < 8; i++)
+        for (int j = i + 1; j < 8; j++) std::swap(a[i * s + j], a[j * s + i]);
+}
+
+// Split point for the recursion, rounded to a multiple of the 8×8 tile
+inline int splitPoint(int n) {
+    int h = n / 2;
+    return h >= 8 ? h & ~7 : h;
+}
+
+/**
+ * transposeCopyRec - dst (cols×rows) = src (rows×cols)^T
+ */
+template <typename T>
+void transposeCopyRec(const T* src, size_t ss, T* dst, size_t ds, int rows, int cols) {
+    if (rows <= TRANSPOSE_TILE && cols <= TRANSPOSE_TILE) {
+        int i = 0;
+        for (; i + 8 <= rows; i += 8) {
+            int j = 0;
+            for (; j + 8 <= cols; j += 8) copyTile8x8(src + i * ss + j, ss, dst + j * ds + i, ds);
+            for (int ii = i; ii < i + 8; ii++)
+                for (int jj = j; jj < cols; jj++) dst[jj * ds + ii] = src[ii * ss + jj];
+        }
+        for (; i < rows; i++)
+            for (int j = 0; j < cols; j++) dst[j * ds + i] = src[i * ss + j];
+        return;
+    }
+
+    if (rows >= cols) {
+        int h = splitPoint(rows);
+        transposeCopyRec(src, ss, dst, ds, h, cols);
+        transposeCopyRec(src + h * ss, ss, dst + h, ds, rows - h, cols);
+    } else {
+        int w = splitPoint(cols);
+        transposeCopyRec(src, ss, dst, ds, rows, w);
+        transposeCopyRec(src + w, ss, dst + w * ds, ds, rows, cols - w);
+    }
+}
+
+/**
+ * transposeSwapRec - Exchange x (rows×cols) with y^T, where y is cols×rows
+ */
+template <typename T>
+void transposeSwapRec(T* x, T* y, size_t s, int rows, int cols) {
+    if (rows <= TRANSPOSE_TILE && cols <= TRANSPOSE_TILE) {
+        int i = 0;
+        for (; i + 8 <= rows; i += 8) {
+            int j = 0;
+            for (; j + 8 <= cols; j += 8) swapTile8x8(x + i * s + j, y + j * s + i, s);
+            for (int ii = i; ii < i + 8; ii++)
+                for (int jj = j; jj < cols; jj++) std::swap(x[ii * s + jj], y[jj * s + ii]);
+        }
+        for (; i < rows; i++)
+            for (int j = 0; j < cols; j++) std::swap(x[i * s + j], y[j * s + i]);
+        return;
+    }
+
+    if (rows >= cols) {
+        int h = splitPoint(rows);
+        transposeSwapRec(x, y, s, h, cols);
+        transposeSwapRec(x + h * s, y + h, s, rows - h, cols);
+    } else {
+        int w = splitPoint(cols);
+        transposeSwapRec(x, y, s, rows, w);
+        transposeSwapRec(x + w, y + w * s, s, rows, cols - w);
+    }
+}
+
+/**
+ * transposeInPlaceRec - Transpose the n×n block at a in place
+ *
+ * [A11 A12]^T = [A11^T A21^T]
+ * [A21 A22]     [A12^T A22^T]
+ */
+template <typename T>
+void transposeInPlaceRec(T* a, size_t s, int n) {
+    if (n <= TRANSPOSE_TILE) {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            transposeDiagTile8x8(a + i * s + i, s);
+            int j = i + 8;
+            for (; j + 8 <= n; j += 8) swapTile8x8(a + i * s + j, a + j * s + i, s);
+            for (int ii = i; ii < i + 8; ii++)
+                for (int jj = j; jj < n; jj++) std::swap(a[ii * s + jj], a[jj * s + ii]);
+        }
+        for (; i < n; i++)
+            for (int j = i + 1; j < n; j++) std::swap(a[i * s + j], a[j * s + i]);
+        return;
+    }
+
+    int h = splitPoint(n);
+    transposeInPlaceRec(a, s, h);
+    transposeInPlaceRec(a + h * s + h, s, n - h);
+    transposeSwapRec(a + h, a + h * s, s, h, n - h);
+}
+
+} // namespace transpose_detail
+
+/**
+ * transposeBlocked - Out-of-place cache-oblivious transpose, dst = src^T
+ * @src: The rows×cols input matrix (or view)
+ * @dst: A cols×rows output view; must not overlap @src
+ */
+template <typename T>
+void transposeBlocked(MatrixView<const T> src, MatrixView<T> dst) {
+    if (dst.rows() != src.cols() || dst.cols() != src.rows()) {
+        throw std::invalid_argument("Transpose destination must have swapped dimensions");
+    }
+    if (src.empty()) return;
+    transpose_detail::transposeCopyRec(src.data(), (size_t)src.stride(), dst.data(), (size_t)dst.stride(),
+                                       src.rows(), src.cols());
+}
+
+/**
+ * transposeInPlaceBlocked - In-place cache-oblivious transpose of a square matrix
+ * @matrix: The n×n matrix (or view)
+ */
+template <typename T>
+void transposeInPlaceBlocked(MatrixView<T> matrix) {
+    if (!matrix.isSquare()) {
+        throw std::invalid_argument("In-place transpose requires a square matrix");
+    }
+    if (matrix.empty()) return;
+    transpose_detail::transposeInPlaceRec(matrix.data(), (size_t)matrix.stride(), matrix.rows());
+}
+
+#endif // TRANSPOSE_H